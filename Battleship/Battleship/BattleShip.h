@@ -12,7 +12,10 @@ enum
     BOARD_SIZE = 10,
     NUM_SHIPS = 5,
     PLAYER_NAME_SIZE = 8, //Player1, Player2
-    MAX_SHIP_SIZE = AIRCRAFT_CARRIER_SIZE
+    MAX_SHIP_SIZE = AIRCRAFT_CARRIER_SIZE,
+    MIN_SHIP_SIZE = SUBMARINE_SIZE,
+    HIT_PLACEMENT_WEIGHT = 50, //placements through an unsunk hit are this much more likely
+    TOURNAMENT_DEFAULT_GAMES = 10000
 };
 enum ShipType
 {
@@ -62,6 +65,21 @@ enum PlayerType
     PT_HUMAN = 0,
     PT_AI
 };
+//One bit per board cell, cell (row, col) is bit row * BOARD_SIZE + col spread over two words
+struct BoardMask
+{
+    unsigned long long low;  //cells 0 - 63
+    unsigned long long high; //cells 64 - 99
+};
+
+struct TournamentResult
+{
+    int gamesPlayed;
+    long long totalShots;
+    int minShots;
+    int maxShots;
+};
+
 struct Player
 {
     PlayerType playerType;
@@ -103,7 +121,14 @@ void SwitchPlayers(Player** currentPlayer, Player** otherPlayer);
 void DisplayWinner(const Player& player1, const Player& player2);
 
 PlayerType GetPlayer2Type();
-ShipPositionType GetAIGuess(const Player& aiPlayer);
+ShipPositionType GetAIGuess(const Player& aiPlayer, const Player& otherPlayer);
+void ComputeProbabilityMap(const Player& aiPlayer, const Player& otherPlayer, int heatMap[BOARD_SIZE][BOARD_SIZE]);
 void SetupAIBoards(Player& player);
 
+void SeedRandom(unsigned int seed);
+int GetRandom();
+int PlayAIGame(Player& player1, Player& player2);
+void PlayTournamentGames(int numberOfGames, unsigned int seed, TournamentResult& result);
+int RunTournament(int numberOfGames, int numberOfThreads);
+
 #endif
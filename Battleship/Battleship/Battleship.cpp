@@ -7,17 +7,32 @@
 //============================================================================
 #include <iostream>
 #include <cstring>
+#include <cstdio>
 #include <cstdlib>
 #include <ctime>
+#include <vector>
+#include <thread>
+#include <chrono>
 #include "Utils.h"
 #include "BattleShip.h"
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 using namespace std;
 
 const char* INPUT_ERROR_STRING = "Input error! Please try again.";
 
-int main(){
-    srand(time(NULL));
+int main(int argc, char* argv[]){
+    if (argc > 1 && strcmp(argv[1], "--tournament") == 0)
+    {
+        int numberOfGames = (argc > 2) ? atoi(argv[2]) : TOURNAMENT_DEFAULT_GAMES;
+        int numberOfThreads = (argc > 3) ? atoi(argv[3]) : 0;
+        return RunTournament(numberOfGames, numberOfThreads);
+    }
+
+    SeedRandom(unsigned(time(NULL)));
 
     Player player1;
     Player player2;
@@ -35,7 +50,7 @@ int main(){
 
 void InitializePlayer(Player& player, const char* playerName){
     if (playerName != nullptr && strlen(playerName) > 0){
-        strcpy_s(player.playerName, playerName);
+        snprintf(player.playerName, PLAYER_NAME_SIZE, "%s", playerName);
     }
 
     InitializeShip(player.ships[0], AIRCRAFT_CARRIER_SIZE, ST_AIRCRAFT_CARRIER);
@@ -78,7 +93,7 @@ void PlayGame(Player& player1, Player& player2){
                 guess = GetBoardPosition();
             }
             else {
-                guess = GetAIGuess(*currentPlayer);
+                guess = GetAIGuess(*currentPlayer, *otherPlayer);
             }
 
             isValidGuess = currentPlayer->guessBoard[guess.row][guess.col] == GT_NONE;
@@ -259,14 +274,14 @@ void SetupBoards(Player& player) {
 bool IsValidPlacement(const Player& player, const Ship& currentShip, const ShipPositionType& shipPosition, ShipOrientationType orientation) {
     if (orientation == SO_HORIZONTAL) {
         for (int c = shipPosition.col; c < (shipPosition.col + currentShip.shipSize); c++) {
-            if (player.shipBoard[shipPosition.row][c].shipType != ST_NONE || c >= BOARD_SIZE) {
+            if (c >= BOARD_SIZE || player.shipBoard[shipPosition.row][c].shipType != ST_NONE) {
                 return false;
             }
         }
     }
     else {
         for (int r = shipPosition.row; r < (shipPosition.row + currentShip.shipSize); r++) {
-            if (player.shipBoard[r][shipPosition.col].shipType != ST_NONE || r >= BOARD_SIZE) {
+            if (r >= BOARD_SIZE || player.shipBoard[r][shipPosition.col].shipType != ST_NONE) {
                 return false;
             }
         }
@@ -509,15 +524,211 @@ ShipPositionType GetRandomPosition()
 {
     ShipPositionType guess;
 
-    guess.row = rand() % BOARD_SIZE;
-    guess.col = rand() % BOARD_SIZE;
+    guess.row = GetRandom() % BOARD_SIZE;
+    guess.col = GetRandom() % BOARD_SIZE;
 
     return guess;
 }
 
-ShipPositionType GetAIGuess(const Player& aiPlayer)
+void SetCell(BoardMask& mask, int cell)
+{
+    if (cell < 64)
+    {
+        mask.low |= 1ULL << cell;
+    }
+    else
+    {
+        mask.high |= 1ULL << (cell - 64);
+    }
+}
+
+bool Overlaps(const BoardMask& mask1, const BoardMask& mask2)
+{
+    return ((mask1.low & mask2.low) | (mask1.high & mask2.high)) != 0;
+}
+
+int LowestCell(unsigned long long bits)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    if (_BitScanForward(&index, (unsigned long)bits))
+    {
+        return int(index);
+    }
+    _BitScanForward(&index, (unsigned long)(bits >> 32));
+    return int(index) + 32;
+#else
+    return __builtin_ctzll(bits);
+#endif
+}
+
+int CountCells(unsigned long long bits)
+{
+    int count = 0;
+    for (; bits != 0; bits &= bits - 1)
+    {
+        count++;
+    }
+    return count;
+}
+
+//Every way a ship of each size fits on an empty board
+std::vector<std::vector<BoardMask>> BuildShipPlacements()
+{
+    std::vector<std::vector<BoardMask>> placements(MAX_SHIP_SIZE + 1);
+
+    for (int size = MIN_SHIP_SIZE; size <= MAX_SHIP_SIZE; size++)
+    {
+        for (int r = 0; r < BOARD_SIZE; r++)
+        {
+            for (int c = 0; c + size <= BOARD_SIZE; c++)
+            {
+                BoardMask horizontal = { 0, 0 };
+                BoardMask vertical = { 0, 0 };
+
+                for (int i = 0; i < size; i++)
+                {
+                    SetCell(horizontal, r * BOARD_SIZE + c + i);
+                    SetCell(vertical, (c + i) * BOARD_SIZE + r);
+                }
+
+                placements[size].push_back(horizontal);
+                placements[size].push_back(vertical);
+            }
+        }
+    }
+
+    return placements;
+}
+
+const std::vector<BoardMask>& GetShipPlacements(int shipSize)
+{
+    //built on first use, thread safe so tournament threads can share it
+    static const std::vector<std::vector<BoardMask>> placements = BuildShipPlacements();
+
+    return placements[shipSize];
+}
+
+void ComputeProbabilityMap(const Player& aiPlayer, const Player& otherPlayer, int heatMap[BOARD_SIZE][BOARD_SIZE])
+{
+    BoardMask blocked = { 0, 0 };      //misses and the cells of sunk ships, no ship can go there
+    BoardMask openHits = { 0, 0 };     //hits on ships that are not sunk yet
+
+    for (int r = 0; r < BOARD_SIZE; r++)
+    {
+        for (int c = 0; c < BOARD_SIZE; c++)
+        {
+            heatMap[r][c] = 0;
+
+            if (aiPlayer.guessBoard[r][c] == GT_MISSED)
+            {
+                SetCell(blocked, r * BOARD_SIZE + c);
+            }
+            else if (aiPlayer.guessBoard[r][c] == GT_HIT)
+            {
+                SetCell(openHits, r * BOARD_SIZE + c);
+            }
+        }
+    }
+
+    //A sunk ship is announced, so its cells are known and its size is no longer in play
+    bool isSunk[NUM_SHIPS];
+    for (int i = 0; i < NUM_SHIPS; i++)
+    {
+        const Ship& ship = otherPlayer.ships[i];
+        isSunk[i] = IsSunk(otherPlayer, ship);
+
+        if (isSunk[i])
+        {
+            for (int j = 0; j < ship.shipSize; j++)
+            {
+                int row = ship.position.row + (ship.orientation == SO_VERTICAL ? j : 0);
+                int col = ship.position.col + (ship.orientation == SO_HORIZONTAL ? j : 0);
+                int cell = row * BOARD_SIZE + col;
+
+                SetCell(blocked, cell);
+                if (cell < 64)
+                {
+                    openHits.low &= ~(1ULL << cell);
+                }
+                else
+                {
+                    openHits.high &= ~(1ULL << (cell - 64));
+                }
+            }
+        }
+    }
+
+    //Count how many placements of the remaining ships cover each cell
+    for (int i = 0; i < NUM_SHIPS; i++)
+    {
+        if (isSunk[i])
+        {
+            continue;
+        }
+
+        const std::vector<BoardMask>& placements = GetShipPlacements(otherPlayer.ships[i].shipSize);
+
+        for (size_t p = 0; p < placements.size(); p++)
+        {
+            const BoardMask& placement = placements[p];
+
+            if (Overlaps(placement, blocked))
+            {
+                continue;
+            }
+
+            int weight = 1 + HIT_PLACEMENT_WEIGHT * (CountCells(placement.low & openHits.low) + CountCells(placement.high & openHits.high));
+
+            for (unsigned long long bits = placement.low; bits != 0; bits &= bits - 1)
+            {
+                int cell = LowestCell(bits);
+                heatMap[cell / BOARD_SIZE][cell % BOARD_SIZE] += weight;
+            }
+            for (unsigned long long bits = placement.high; bits != 0; bits &= bits - 1)
+            {
+                int cell = 64 + LowestCell(bits);
+                heatMap[cell / BOARD_SIZE][cell % BOARD_SIZE] += weight;
+            }
+        }
+    }
+}
+
+ShipPositionType GetAIGuess(const Player& aiPlayer, const Player& otherPlayer)
 {
-    return GetRandomPosition();
+    int heatMap[BOARD_SIZE][BOARD_SIZE];
+    ComputeProbabilityMap(aiPlayer, otherPlayer, heatMap);
+
+    ShipPositionType guess = GetRandomPosition();
+    int bestScore = -1;
+    int numberOfTies = 0;
+
+    for (int r = 0; r < BOARD_SIZE; r++)
+    {
+        for (int c = 0; c < BOARD_SIZE; c++)
+        {
+            if (aiPlayer.guessBoard[r][c] != GT_NONE)
+            {
+                continue;
+            }
+
+            if (heatMap[r][c] > bestScore)
+            {
+                bestScore = heatMap[r][c];
+                numberOfTies = 1;
+                guess.row = r;
+                guess.col = c;
+            }
+            else if (heatMap[r][c] == bestScore && GetRandom() % ++numberOfTies == 0)
+            {
+                //pick evenly between equally good cells so the AI is not predictable
+                guess.row = r;
+                guess.col = c;
+            }
+        }
+    }
+
+    return guess;
 }
 
 
@@ -533,7 +744,7 @@ void SetupAIBoards(Player& player)
         do
         {
             pos = GetRandomPosition();
-            orientation = ShipOrientationType(rand() % 2);
+            orientation = ShipOrientationType(GetRandom() % 2);
 
         } while (!IsValidPlacement(player, currentShip, pos, orientation));
 
@@ -543,3 +754,125 @@ void SetupAIBoards(Player& player)
 
 
 
+
+
+//One random number generator per thread so tournament games can run in parallel
+thread_local unsigned int randomState = 1;
+
+void SeedRandom(unsigned int seed)
+{
+    randomState = (seed == 0) ? 1 : seed;
+}
+
+int GetRandom()
+{
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return int(randomState & 0x7FFFFFFF);
+}
+
+//Plays one AI vs AI game with no output, returns how many shots the winner fired
+int PlayAIGame(Player& player1, Player& player2)
+{
+    player1.playerType = PT_AI;
+    player2.playerType = PT_AI;
+
+    SetupBoards(player1);
+    SetupBoards(player2);
+
+    Player* currentPlayer = &player1;
+    Player* otherPlayer = &player2;
+    int shots[2] = { 0, 0 };
+    int currentIndex = 0;
+
+    do
+    {
+        ShipPositionType guess = GetAIGuess(*currentPlayer, *otherPlayer);
+        UpdateBoards(guess, *currentPlayer, *otherPlayer);
+        shots[currentIndex]++;
+
+        SwitchPlayers(&currentPlayer, &otherPlayer);
+        currentIndex = 1 - currentIndex;
+
+    } while (!IsGameOver(player1, player2));
+
+    return AreAllShipsSunk(player2) ? shots[0] : shots[1];
+}
+
+void PlayTournamentGames(int numberOfGames, unsigned int seed, TournamentResult& result)
+{
+    SeedRandom(seed);
+
+    Player player1;
+    Player player2;
+    InitializePlayer(player1, "AI1");
+    InitializePlayer(player2, "AI2");
+
+    result.gamesPlayed = 0;
+    result.totalShots = 0;
+    result.minShots = BOARD_SIZE * BOARD_SIZE;
+    result.maxShots = 0;
+
+    for (int i = 0; i < numberOfGames; i++)
+    {
+        int shots = PlayAIGame(player1, player2);
+
+        result.gamesPlayed++;
+        result.totalShots += shots;
+        result.minShots = min(result.minShots, shots);
+        result.maxShots = max(result.maxShots, shots);
+    }
+}
+
+int RunTournament(int numberOfGames, int numberOfThreads)
+{
+    if (numberOfThreads <= 0)
+    {
+        numberOfThreads = max(1, int(thread::hardware_concurrency()));
+    }
+
+    unsigned int baseSeed = unsigned(time(NULL));
+    vector<TournamentResult> results(numberOfThreads);
+    vector<thread> threads;
+
+    chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+    for (int t = 0; t < numberOfThreads; t++)
+    {
+        //split the games as evenly as possible between the threads
+        int gamesForThread = numberOfGames / numberOfThreads + (t < numberOfGames % numberOfThreads ? 1 : 0);
+        threads.push_back(thread(PlayTournamentGames, gamesForThread, baseSeed + 7919u * unsigned(t + 1), ref(results[t])));
+    }
+
+    TournamentResult total = { 0, 0, BOARD_SIZE * BOARD_SIZE, 0 };
+    for (int t = 0; t < numberOfThreads; t++)
+    {
+        threads[t].join();
+
+        total.gamesPlayed += results[t].gamesPlayed;
+        total.totalShots += results[t].totalShots;
+        if (results[t].gamesPlayed > 0)
+        {
+            total.minShots = min(total.minShots, results[t].minShots);
+            total.maxShots = max(total.maxShots, results[t].maxShots);
+        }
+    }
+
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - startTime;
+
+    cout << "games:               " << total.gamesPlayed << endl;
+    cout << "threads:             " << numberOfThreads << endl;
+    if (total.gamesPlayed > 0)
+    {
+        cout << "mean shots to win:   " << double(total.totalShots) / total.gamesPlayed << endl;
+        cout << "fewest/most shots:   " << total.minShots << " / " << total.maxShots << endl;
+    }
+    cout << "elapsed:             " << elapsed.count() << " s" << endl;
+    if (elapsed.count() > 0.0)
+    {
+        cout << "games/second:        " << total.gamesPlayed / elapsed.count() << endl;
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -8,6 +8,8 @@
 #include "Utils.h"
 #include <iostream>
 #include <cctype>
+#include <cstdlib>
+#include <limits>
 
 using namespace std;
 
@@ -156,12 +158,19 @@ int GetInteger(const char* prompt, const char* error, const int validInput[], in
 
 void ClearScreen()
 {
+#ifdef _WIN32
 	system("cls");
+#else
+	cout << "\033[2J\033[H" << flush; // ANSI clear screen and cursor home
+#endif
 }
 
 void WaitForKeyPress()
 {
-	system("pause");//for windows only!
-
-	//system("read -n 1 -s -p \"Press any key to continue...\";echo");
+#ifdef _WIN32
+	system("pause");
+#else
+	cout << "Press Enter to continue..." << flush;
+	cin.ignore(numeric_limits<streamsize>::max(), '\n');
+#endif
 }
@@ -0,0 +1,87 @@
+#include "BinaryFile.h"
+#include <fstream>
+#include <iterator>
+#include <cstdio>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+bool CommitTempFile(const std::string& from, const char* to);
+
+void PutUint16(unsigned char* bytes, unsigned int value) {
+	bytes[0] = (unsigned char)(value & 0xFF);
+	bytes[1] = (unsigned char)((value >> 8) & 0xFF);
+}
+
+void PutUint32(unsigned char* bytes, unsigned int value) {
+	PutUint16(bytes, value & 0xFFFF);
+	PutUint16(bytes + 2, value >> 16);
+}
+
+unsigned int GetUint16(const unsigned char* bytes) {
+	return unsigned(bytes[0]) | (unsigned(bytes[1]) << 8);
+}
+
+unsigned int GetUint32(const unsigned char* bytes) {
+	return GetUint16(bytes) | (GetUint16(bytes + 2) << 16);
+}
+
+unsigned int GetChecksum(const unsigned char* bytes, size_t size) {
+	unsigned int hash = 2166136261u;
+
+	for (size_t i = 0; i < size; i++) {
+		hash = (hash ^ bytes[i]) * 16777619u;
+	}
+
+	return hash;
+}
+
+bool WriteBinaryFile(const char* fileName, const std::vector<unsigned char>& bytes) {
+	std::string tempFileName = std::string(fileName) + ".tmp";
+	std::ofstream outFile(tempFileName.c_str(), std::ios::binary | std::ios::trunc);
+
+	if (!outFile.is_open()) {
+		return false;
+	}
+
+	if (!bytes.empty()) {
+		outFile.write(reinterpret_cast<const char*>(&bytes[0]), std::streamsize(bytes.size()));
+	}
+	outFile.close();
+
+	if (outFile.fail()) {
+		std::remove(tempFileName.c_str());
+		return false;
+	}
+
+	return CommitTempFile(tempFileName, fileName);
+}
+
+bool ReadBinaryFile(const char* fileName, std::vector<unsigned char>& bytes) {
+	std::ifstream inFile(fileName, std::ios::binary);
+
+	if (!inFile.is_open()) {
+		return false;
+	}
+
+	bytes.assign(std::istreambuf_iterator<char>(inFile), std::istreambuf_iterator<char>());
+	return !inFile.bad();
+}
+
+// Readers see either the old file or the new one, never part of either
+bool CommitTempFile(const std::string& from, const char* to) {
+#ifdef _WIN32
+	bool isReplaced = MoveFileExA(from.c_str(), to, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+	bool isReplaced = std::rename(from.c_str(), to) == 0;
+#endif
+
+	if (!isReplaced) {
+		std::remove(from.c_str());
+	}
+
+	return isReplaced;
+}
@@ -0,0 +1,22 @@
+#ifndef BINARYFILE_H_
+#define BINARYFILE_H_
+
+#include <vector>
+#include <string>
+#include <cstddef>
+
+// Helpers for the engine's small binary files (high scores, input journals).
+// Numbers are stored little endian whatever the machine is.
+
+void PutUint16(unsigned char* bytes, unsigned int value);
+void PutUint32(unsigned char* bytes, unsigned int value);
+unsigned int GetUint16(const unsigned char* bytes);
+unsigned int GetUint32(const unsigned char* bytes);
+// FNV-1a
+unsigned int GetChecksum(const unsigned char* bytes, size_t size);
+
+// Writes a new file next to the old one and renames it over, so readers see either the old file or the new one
+bool WriteBinaryFile(const char* fileName, const std::vector<unsigned char>& bytes);
+bool ReadBinaryFile(const char* fileName, std::vector<unsigned char>& bytes);
+
+#endif
@@ -0,0 +1,476 @@
+/*
+ * CursesUtils.cpp
+ *
+ *  Created on: Oct 7, 2016
+ *      Author: serge
+ */
+#include "CursesUtils.h"
+#include <vector>
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <chrono>
+#include <fstream>
+
+#ifndef _WIN32
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+// Everything is drawn into backBuffer first. RefreshScreen only sends the cells that differ
+// from frontBuffer (what the terminal is showing) so the cost follows what moved on screen.
+struct ScreenBuffer {
+	int width;
+	int height;
+	std::vector<chtype> cells;
+};
+
+ScreenBuffer frontBuffer = { 0, 0 };
+ScreenBuffer backBuffer = { 0, 0 };
+chtype currentAttributes = A_NORMAL;
+
+const chtype INVALID_CELL = chtype(-1); // never equal to a real cell, forces a repaint
+
+void ResizeScreenBuffers(int width, int height)
+{
+	frontBuffer.width = backBuffer.width = width;
+	frontBuffer.height = backBuffer.height = height;
+	frontBuffer.cells.assign(width * height, INVALID_CELL);
+	backBuffer.cells.assign(width * height, chtype(' '));
+	if (stdscr != NULL)
+	{
+		clearok(stdscr, true);
+	}
+}
+
+void PutCell(int xPos, int yPos, chtype cell)
+{
+	if (xPos >= 0 && xPos < backBuffer.width && yPos >= 0 && yPos < backBuffer.height)
+	{
+		backBuffer.cells[yPos * backBuffer.width + xPos] = cell;
+	}
+}
+
+void InitializeCurses(bool noDelay)
+{
+	initscr();
+	noecho();
+	curs_set(false);
+	nodelay(stdscr, noDelay);
+	keypad(stdscr, true);
+}
+
+void ShutdownCurses()
+{
+	endwin();
+}
+
+void ClearScreen()
+{
+	ClearScreen(COLS, LINES);
+}
+
+// Sized by the caller rather than the terminal, so frames can be drawn with no terminal at all
+void ClearScreen(int width, int height)
+{
+	if (backBuffer.width != width || backBuffer.height != height)
+	{
+		ResizeScreenBuffers(width, height);
+	}
+	else
+	{
+		std::fill(backBuffer.cells.begin(), backBuffer.cells.end(), chtype(' '));
+	}
+}
+
+// One curses call per changed row, covering the first to the last changed cell. Unchanged
+// cells in between cost nothing on the terminal, curses skips them when it refreshes.
+void RefreshScreen()
+{
+	for (int y = 0; y < backBuffer.height; y++)
+	{
+		const chtype* back = &backBuffer.cells[y * backBuffer.width];
+		chtype* front = &frontBuffer.cells[y * frontBuffer.width];
+		std::pair<const chtype*, chtype*> first = std::mismatch(back, back + backBuffer.width, front);
+
+		if (first.first != back + backBuffer.width)
+		{
+			int firstX = int(first.first - back);
+			int lastX = backBuffer.width - 1;
+
+			while (back[lastX] == front[lastX])
+			{
+				lastX--;
+			}
+
+			mvaddchnstr(y, firstX, back + firstX, lastX - firstX + 1);
+			std::copy(back + firstX, back + lastX + 1, front + firstX);
+		}
+	}
+
+	refresh();
+}
+
+int ScreenWidth()
+{
+	return COLS;
+}
+
+int ScreenHeight()
+{
+	return LINES;
+}
+
+int GetChar()
+{
+	return getch();
+}
+
+void DrawCharacter(int xPos, int yPos, char aCharacter)
+{
+	PutCell(xPos, yPos, chtype((unsigned char)aCharacter) | currentAttributes);
+}
+
+void MoveCursor(int xPos, int yPos)
+{
+	move(yPos, xPos);
+}
+
+void DrawSprite(int xPos, int yPos, const char * sprite[], int spriteHeight, int offset)
+{
+	for(int h = 0; h < spriteHeight; h++)
+	{
+		DrawString(xPos, yPos + h, sprite[h + offset]);
+	}
+}
+
+void DrawString(int xPos, int yPos, const char* string) {
+	for (int x = xPos; *string != '\0'; string++)
+	{
+		if (*string == '\t')
+		{
+			// same tab stops as curses
+			do
+			{
+				DrawCharacter(x++, yPos, ' ');
+			} while (x % 8 != 0);
+		}
+		else
+		{
+			DrawCharacter(x++, yPos, *string);
+		}
+	}
+}
+
+void DrawString(int xPos, int yPos, const std::string& string) {
+	DrawString(xPos, yPos, string.c_str());
+}
+
+void DrawFormattedString(int xPos, int yPos, const char* format, ...) {
+	char buffer[256];
+
+	va_list args;
+	va_start(args, format);
+	vsnprintf(buffer, sizeof(buffer), format, args);
+	va_end(args);
+
+	DrawString(xPos, yPos, buffer);
+}
+
+void DrawCells(int xPos, int yPos, const chtype* cells, int count)
+{
+	if (yPos < 0 || yPos >= backBuffer.height)
+	{
+		return;
+	}
+
+	int first = std::max(0, -xPos);
+	int last = std::min(count, backBuffer.width - xPos);
+	chtype* row = &backBuffer.cells[yPos * backBuffer.width];
+
+	for (int i = first; i < last; i++)
+	{
+		if (cells[i] != TRANSPARENT_CELL)
+		{
+			row[xPos + i] = cells[i] | currentAttributes;
+		}
+	}
+}
+
+void InitSpriteStrip(SpriteStrip& strip, const char* sprite[], int spriteWidth, int spriteHeight, int numberOfFrames, int gap, int count)
+{
+	strip.spriteWidth = spriteWidth;
+	strip.spriteHeight = spriteHeight;
+	strip.numberOfFrames = numberOfFrames;
+	strip.stride = spriteWidth + gap;
+	strip.count = count;
+	strip.lineLength = count * strip.stride;
+	strip.cells.assign(size_t(numberOfFrames) * spriteHeight * strip.lineLength, TRANSPARENT_CELL);
+
+	for (int line = 0; line < numberOfFrames * spriteHeight; line++)
+	{
+		chtype* cells = &strip.cells[size_t(line) * strip.lineLength];
+
+		for (int x = 0; x < spriteWidth && sprite[line][x] != '\0'; x++)
+		{
+			cells[x] = chtype((unsigned char)sprite[line][x]);
+		}
+		for (int i = 1; i < count; i++)
+		{
+			std::copy(cells, cells + strip.stride, cells + i * strip.stride);
+		}
+	}
+}
+
+void DrawSpriteStrip(const SpriteStrip& strip, int xPos, int yPos, int frame, int first, int count)
+{
+	int length = count * strip.stride - (strip.stride - strip.spriteWidth); // no gap after the last one
+
+	for (int line = 0; line < strip.spriteHeight; line++)
+	{
+		const chtype* cells = &strip.cells[size_t(frame * strip.spriteHeight + line) * strip.lineLength + first * strip.stride];
+		DrawCells(xPos + first * strip.stride, yPos + line, cells, length);
+	}
+}
+
+void AttributeOn(int attribute)
+{
+	currentAttributes |= chtype(attribute);
+}
+
+void AttributeOff(int attribute)
+{
+	currentAttributes &= ~chtype(attribute);
+}
+
+long long GetTimeMicroseconds()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool WaitForInput(long long timeoutMicroseconds)
+{
+	// curses may already hold a key it read earlier, which poll would never see
+	int ch = getch();
+	if (ch != ERR)
+	{
+		ungetch(ch);
+		return true;
+	}
+
+	int timeoutMilliseconds = int((timeoutMicroseconds + 999) / 1000);
+
+#ifdef _WIN32
+	timeout(timeoutMilliseconds);
+	ch = getch();
+	nodelay(stdscr, true);
+
+	if (ch != ERR)
+	{
+		ungetch(ch);
+		return true;
+	}
+	return false;
+#else
+	struct pollfd stdinPoll;
+	stdinPoll.fd = STDIN_FILENO;
+	stdinPoll.events = POLLIN;
+	stdinPoll.revents = 0;
+
+	return poll(&stdinPoll, 1, timeoutMilliseconds) > 0;
+#endif
+}
+
+void InitializeFrameTimer(FrameTimer& timer, int framesPerSecond)
+{
+	timer.frameDuration = 1000000 / framesPerSecond;
+	timer.idleFrameDuration = 1000000;
+	timer.lastFrameTime = GetTimeMicroseconds();
+	timer.nextFrameTime = timer.lastFrameTime; // draw the first frame straight away
+	timer.accumulator = timer.frameDuration;
+}
+
+// Sleeps until the next frame is due or a key arrives. Returns true when it is time to update and draw.
+// While idle the frame deadline is stretched, so a static screen only redraws after input.
+bool WaitForFrameOrInput(FrameTimer& timer, bool idle)
+{
+	long long deadline = timer.nextFrameTime;
+	if (idle && timer.lastFrameTime + timer.idleFrameDuration > deadline)
+	{
+		deadline = timer.lastFrameTime + timer.idleFrameDuration;
+	}
+
+	long long now = GetTimeMicroseconds();
+	if (now >= deadline)
+	{
+		return true;
+	}
+
+	if (WaitForInput(deadline - now))
+	{
+		return idle;
+	}
+
+	return GetTimeMicroseconds() >= deadline;
+}
+
+// Call when WaitForFrameOrInput says a frame is due. Returns how many steps of frameDuration to
+// simulate before drawing: more than one when drawing fell behind, none when it isn't time yet.
+// Idle screens only wait for a key, so the time spent on them is never caught up.
+int AdvanceFixedTimestep(FrameTimer& timer, bool idle)
+{
+	long long now = GetTimeMicroseconds();
+	int steps;
+
+	timer.accumulator += now - timer.lastFrameTime;
+	timer.lastFrameTime = now;
+
+	if (idle)
+	{
+		steps = 1;
+		timer.accumulator = 0;
+	}
+	else
+	{
+		steps = int(std::min<long long>(timer.accumulator / timer.frameDuration, MAX_CATCH_UP_STEPS));
+		timer.accumulator -= steps * timer.frameDuration;
+		if (timer.accumulator >= timer.frameDuration)
+		{
+			timer.accumulator = 0; // too far behind to catch up, let the game slow down instead
+		}
+	}
+
+	timer.nextFrameTime = now + timer.frameDuration - timer.accumulator;
+	return steps;
+}
+
+long long GetTimeNanoseconds()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void InitializeProfiler(FrameProfiler& profiler, long long frameBudget)
+{
+	profiler.samples.clear();
+	profiler.currentFrame = ProfileSample();
+	profiler.numberOfFrames = 0;
+	profiler.sectionStart = GetTimeNanoseconds();
+	profiler.frameBudget = frameBudget;
+	profiler.overruns = 0;
+	profiler.isOverlayVisible = false;
+}
+
+void BeginProfileSection(FrameProfiler& profiler)
+{
+	profiler.sectionStart = GetTimeNanoseconds();
+}
+
+void EndProfileSection(FrameProfiler& profiler, ProfileSection section)
+{
+	profiler.currentFrame.sectionTimes[section] += float(GetTimeNanoseconds() - profiler.sectionStart) / 1000.0f;
+}
+
+void EndProfiledFrame(FrameProfiler& profiler)
+{
+	float total = 0;
+	for (int i = 0; i < NUM_PROFILE_SECTIONS; i++)
+	{
+		total += profiler.currentFrame.sectionTimes[i];
+	}
+	if (total > float(profiler.frameBudget))
+	{
+		profiler.overruns++;
+	}
+
+	if (profiler.samples.size() < MAX_PROFILED_FRAMES)
+	{
+		profiler.samples.push_back(profiler.currentFrame);
+	}
+	else
+	{
+		profiler.samples[profiler.numberOfFrames % MAX_PROFILED_FRAMES] = profiler.currentFrame;
+	}
+
+	profiler.numberOfFrames++;
+	profiler.currentFrame = ProfileSample();
+}
+
+// i = 0 is the oldest frame still kept
+const ProfileSample& GetProfileSample(const FrameProfiler& profiler, long long i)
+{
+	long long firstFrame = profiler.numberOfFrames - (long long)profiler.samples.size();
+	return profiler.samples[(firstFrame + i) % MAX_PROFILED_FRAMES];
+}
+
+void DrawProfilerOverlay(const FrameProfiler& profiler, int xPos, int yPos)
+{
+	static const char* SECTION_NAMES[NUM_PROFILE_SECTIONS] = { "input", "update", "draw", "refresh" };
+
+	if (!profiler.isOverlayVisible)
+	{
+		return;
+	}
+
+	long long count = std::min<long long>(PROFILER_WINDOW, (long long)profiler.samples.size());
+	long long first = (long long)profiler.samples.size() - count;
+	std::vector<float> times(count);
+
+	DrawFormattedString(xPos, yPos, "%-8s %8s %8s %8s", "ms", "min", "avg", "p99");
+
+	for (int section = 0; section < NUM_PROFILE_SECTIONS; section++)
+	{
+		float sum = 0;
+		for (long long i = 0; i < count; i++)
+		{
+			times[i] = GetProfileSample(profiler, first + i).sectionTimes[section];
+			sum += times[i];
+		}
+
+		if (count == 0)
+		{
+			DrawFormattedString(xPos, yPos + 1 + section, "%-8s %8s %8s %8s", SECTION_NAMES[section], "-", "-", "-");
+			continue;
+		}
+
+		float minimum = *std::min_element(times.begin(), times.end());
+		std::vector<float>::iterator p99 = times.begin() + (count * 99) / 100;
+		std::nth_element(times.begin(), p99, times.end());
+
+		DrawFormattedString(xPos, yPos + 1 + section, "%-8s %8.3f %8.3f %8.3f", SECTION_NAMES[section],
+			minimum / 1000.0f, sum / count / 1000.0f, *p99 / 1000.0f);
+	}
+
+	DrawFormattedString(xPos, yPos + 1 + NUM_PROFILE_SECTIONS, "over %.1f ms budget: %lld of %lld frames",
+		profiler.frameBudget / 1000.0, profiler.overruns, profiler.numberOfFrames);
+}
+
+bool WriteProfilerCsv(const FrameProfiler& profiler, const char* fileName)
+{
+	std::ofstream outFile(fileName);
+	if (!outFile.is_open())
+	{
+		return false;
+	}
+
+	long long firstFrame = profiler.numberOfFrames - (long long)profiler.samples.size();
+
+	outFile << "frame,input_us,update_us,draw_us,refresh_us,total_us\n";
+	outFile.setf(std::ios::fixed);
+	outFile.precision(3);
+	for (long long i = 0; i < (long long)profiler.samples.size(); i++)
+	{
+		const ProfileSample& sample = GetProfileSample(profiler, i);
+		float total = 0;
+
+		outFile << firstFrame + i;
+		for (int section = 0; section < NUM_PROFILE_SECTIONS; section++)
+		{
+			outFile << ',' << sample.sectionTimes[section];
+			total += sample.sectionTimes[section];
+		}
+		outFile << ',' << total << '\n';
+	}
+
+	outFile.close();
+	return !outFile.fail();
+}
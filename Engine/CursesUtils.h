@@ -0,0 +1,123 @@
+/*
+ * CursesUtils.h
+ *
+ *  Created on: Oct 7, 2016
+ *      Author: serge
+ */
+
+#ifndef CURSESUTILS_H_
+#define CURSESUTILS_H_
+
+#include "curses.h"
+#include <ctime>
+#include <vector>
+#include <string>
+
+enum ArrowKeys
+{
+	UP = KEY_UP,
+	DOWN = KEY_DOWN,
+	LEFT = KEY_LEFT,
+	RIGHT = KEY_RIGHT
+};
+
+// Paces the game loop off a monotonic clock. All times are in microseconds.
+struct FrameTimer
+{
+	long long frameDuration;
+	long long idleFrameDuration; // used while nothing on screen animates
+	long long nextFrameTime;
+	long long lastFrameTime;
+	long long accumulator; // time that has passed but not been simulated yet
+};
+
+enum ProfileSection
+{
+	PROFILE_INPUT = 0,
+	PROFILE_UPDATE,
+	PROFILE_DRAW,
+	PROFILE_REFRESH,
+	NUM_PROFILE_SECTIONS
+};
+
+enum
+{
+	MAX_CATCH_UP_STEPS = 5, // fixed steps run before one render at most, the rest of the backlog is dropped
+	PROFILER_TOGGLE_KEY = 'p',
+	PROFILER_WINDOW = 256, // frames the overlay statistics are taken over
+	MAX_PROFILED_FRAMES = 1 << 18 // oldest frames are dropped from the CSV after this
+};
+
+struct ProfileSample
+{
+	float sectionTimes[NUM_PROFILE_SECTIONS]; // microseconds
+};
+
+// Times the parts of each frame. Input is read between frames too, so its time adds up
+// until the frame it belongs to is finished.
+struct FrameProfiler
+{
+	std::vector<ProfileSample> samples; // ring of the last MAX_PROFILED_FRAMES frames
+	ProfileSample currentFrame;
+	long long numberOfFrames;
+	long long sectionStart; // nanoseconds
+	long long frameBudget; // microseconds
+	long long overruns; // frames that took longer than frameBudget
+	bool isOverlayVisible;
+};
+
+// One sprite repeated in a row with a gap after each, rendered into screen cells once so a
+// run of neighbours is drawn a whole line at a time. Lines of every animation frame are
+// stored one after the other: cells[(frame * spriteHeight + line) * lineLength + x].
+// Gaps, and cells past the end of a short sprite line, hold TRANSPARENT_CELL and leave the
+// screen under them alone the way DrawSprite does.
+struct SpriteStrip
+{
+	int spriteWidth;
+	int spriteHeight;
+	int numberOfFrames;
+	int stride; // sprite width plus the gap
+	int count;
+	int lineLength; // count * stride
+	std::vector<chtype> cells;
+};
+
+const chtype TRANSPARENT_CELL = 0;
+
+void InitializeCurses(bool nodelay);
+void ShutdownCurses();
+void ClearScreen();
+void ClearScreen(int width, int height);
+void RefreshScreen();
+int ScreenWidth();
+int ScreenHeight();
+int GetChar();
+void DrawCharacter(int xPos, int yPos, char aCharacter);
+void MoveCursor(int xPos, int yPos);
+void DrawSprite(int xPos, int yPos, const char* sprite[], int spriteHeight, int offset = 0);
+void DrawString(int xPos, int yPos, const char* string);
+void DrawString(int xPos, int yPos, const std::string& string);
+void DrawFormattedString(int xPos, int yPos, const char* format, ...);
+// Copies cells to the screen as they are, skipping TRANSPARENT_CELL. No tab handling.
+void DrawCells(int xPos, int yPos, const chtype* cells, int count);
+void InitSpriteStrip(SpriteStrip& strip, const char* sprite[], int spriteWidth, int spriteHeight, int numberOfFrames, int gap, int count);
+// Draws sprites first to first + count - 1 of the strip, with sprite 0 at xPos
+void DrawSpriteStrip(const SpriteStrip& strip, int xPos, int yPos, int frame, int first, int count);
+void AttributeOn(int attribute);
+void AttributeOff(int attribute);
+
+long long GetTimeMicroseconds();
+bool WaitForInput(long long timeoutMicroseconds);
+void InitializeFrameTimer(FrameTimer& timer, int framesPerSecond);
+bool WaitForFrameOrInput(FrameTimer& timer, bool idle);
+int AdvanceFixedTimestep(FrameTimer& timer, bool idle);
+
+long long GetTimeNanoseconds();
+void InitializeProfiler(FrameProfiler& profiler, long long frameBudget);
+void BeginProfileSection(FrameProfiler& profiler);
+void EndProfileSection(FrameProfiler& profiler, ProfileSection section);
+void EndProfiledFrame(FrameProfiler& profiler);
+void DrawProfilerOverlay(const FrameProfiler& profiler, int xPos, int yPos);
+bool WriteProfilerCsv(const FrameProfiler& profiler, const char* fileName);
+
+#endif /* CURSESUTILS_H_ */
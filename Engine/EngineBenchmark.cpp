@@ -0,0 +1,173 @@
+// Micro-benchmarks for the engine pieces every frame goes through. Nothing here needs a terminal:
+// drawing goes into the screen buffers only, the way TextInvaders --stress draws.
+//
+// EngineBenchmark [iterations]
+
+#include "CursesUtils.h"
+#include "HighScoreFile.h"
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+using namespace std;
+
+enum {
+	DEFAULT_ITERATIONS = 1000000,
+	SCREEN_WIDTH = 200,
+	SCREEN_HEIGHT = 60,
+	BENCHMARK_MAX_SCORES = 10,
+	BENCHMARK_STRIP_SPRITES = 11, // a row of the TextInvaders swarm
+	BENCHMARK_STRIP_GAP = 1
+};
+
+const char* BENCHMARK_SPRITE[] = { "/oo\\", "<  >" };
+const char* BENCHMARK_FILE = "EngineBenchmark.dat";
+
+unsigned int benchmarkRandom = 1;
+
+unsigned int NextRandom();
+void Report(const char* name, long long startTime, long long count, const char* unit);
+void BenchmarkClock(long long iterations);
+void BenchmarkDrawString(long long iterations);
+void BenchmarkDrawSprite(long long iterations);
+void BenchmarkDrawSpriteStrip(long long iterations);
+void BenchmarkProfiler(long long iterations);
+void BenchmarkInsertHighScore(long long iterations);
+void BenchmarkSaveHighScores(long long iterations);
+
+int main(int argc, char* argv[]) {
+	long long iterations = (argc > 1) ? atoll(argv[1]) : DEFAULT_ITERATIONS;
+	if (iterations <= 0) {
+		cout << "Iterations must be positive" << endl;
+		return 1;
+	}
+
+	BenchmarkClock(iterations);
+	BenchmarkDrawString(iterations / 1000 + 1);
+	BenchmarkDrawSprite(iterations);
+	BenchmarkDrawSpriteStrip(iterations / BENCHMARK_STRIP_SPRITES + 1);
+	BenchmarkProfiler(iterations);
+	BenchmarkInsertHighScore(iterations);
+	BenchmarkSaveHighScores(iterations / 10000 + 1);
+
+	return 0;
+}
+
+unsigned int NextRandom() {
+	benchmarkRandom = benchmarkRandom * 1103515245u + 12345u;
+	return benchmarkRandom >> 8;
+}
+
+void Report(const char* name, long long startTime, long long count, const char* unit) {
+	double elapsed = double(GetTimeNanoseconds() - startTime);
+	printf("%-22s %10.2f ns/%s\n", name, elapsed / double(count), unit);
+}
+
+void BenchmarkClock(long long iterations) {
+	long long sum = 0;
+	long long startTime = GetTimeNanoseconds();
+
+	for (long long i = 0; i < iterations; i++) {
+		sum += GetTimeNanoseconds() & 1;
+	}
+
+	Report("clock read:", startTime, iterations, "call");
+	if (sum < 0) {
+		cout << sum; // keeps the loop
+	}
+}
+
+// a full screen of text, row by row, the way the intro and high score screens are drawn
+void BenchmarkDrawString(long long iterations) {
+	string row(SCREEN_WIDTH, 'x');
+	long long startTime = GetTimeNanoseconds();
+
+	for (long long i = 0; i < iterations; i++) {
+		ClearScreen(SCREEN_WIDTH, SCREEN_HEIGHT);
+		for (int y = 0; y < SCREEN_HEIGHT; y++) {
+			DrawString(0, y, row);
+		}
+	}
+
+	Report("clear + draw string:", startTime, iterations * SCREEN_WIDTH * SCREEN_HEIGHT, "cell");
+}
+
+void BenchmarkDrawSprite(long long iterations) {
+	ClearScreen(SCREEN_WIDTH, SCREEN_HEIGHT);
+	long long startTime = GetTimeNanoseconds();
+
+	for (long long i = 0; i < iterations; i++) {
+		DrawSprite(int(i % (SCREEN_WIDTH - 4)), int(i % (SCREEN_HEIGHT - 2)), BENCHMARK_SPRITE, 2);
+	}
+
+	Report("draw sprite:", startTime, iterations, "sprite");
+}
+
+// the same sprite a whole row at a time, the way TextInvaders draws its aliens
+void BenchmarkDrawSpriteStrip(long long iterations) {
+	SpriteStrip strip;
+	InitSpriteStrip(strip, BENCHMARK_SPRITE, 4, 2, 1, BENCHMARK_STRIP_GAP, BENCHMARK_STRIP_SPRITES);
+	ClearScreen(SCREEN_WIDTH, SCREEN_HEIGHT);
+	long long startTime = GetTimeNanoseconds();
+
+	for (long long i = 0; i < iterations; i++) {
+		DrawSpriteStrip(strip, int(i % (SCREEN_WIDTH - strip.lineLength)), int(i % (SCREEN_HEIGHT - 2)), 0, 0, BENCHMARK_STRIP_SPRITES);
+	}
+
+	Report("draw sprite strip:", startTime, iterations * BENCHMARK_STRIP_SPRITES, "sprite");
+}
+
+void BenchmarkProfiler(long long iterations) {
+	FrameProfiler profiler;
+	InitializeProfiler(profiler, 1000000);
+	long long startTime = GetTimeNanoseconds();
+
+	for (long long i = 0; i < iterations; i++) {
+		BeginProfileSection(profiler);
+		EndProfileSection(profiler, PROFILE_UPDATE);
+		EndProfiledFrame(profiler);
+	}
+
+	Report("profiled frame:", startTime, iterations, "frame");
+}
+
+void BenchmarkInsertHighScore(long long iterations) {
+	HighScoreTable table;
+	InitHighScoreTable(table, BENCHMARK_MAX_SCORES, false, NULL, NULL);
+	Score score;
+	score.name = "AAAAA";
+	long long startTime = GetTimeNanoseconds();
+
+	for (long long i = 0; i < iterations; i++) {
+		score.score = int(NextRandom() % 100000);
+		InsertHighScore(table, score, table.maxScores);
+	}
+
+	Report("insert high score:", startTime, iterations, "score");
+}
+
+// the save that happens each time a game ends with a new high score, then reading it back
+void BenchmarkSaveHighScores(long long iterations) {
+	HighScoreTable table;
+	InitHighScoreTable(table, BENCHMARK_MAX_SCORES, false, BENCHMARK_FILE, NULL);
+	for (int i = 0; i < BENCHMARK_MAX_SCORES; i++) {
+		AddHighScore(table, int(NextRandom() % 100000), "AAAAA");
+	}
+
+	long long startTime = GetTimeNanoseconds();
+	bool isLoaded = true;
+
+	for (long long i = 0; i < iterations; i++) {
+		SaveHighScoreFile(table, BENCHMARK_FILE);
+		isLoaded = LoadHighScoreFile(table, BENCHMARK_FILE, table.maxScores) && isLoaded;
+	}
+
+	Report("save + load scores:", startTime, iterations, "round trip");
+	remove(BENCHMARK_FILE);
+
+	if (!isLoaded) {
+		cout << "high score file didn't load back" << endl;
+		exit(1);
+	}
+}
@@ -0,0 +1,60 @@
+#ifndef GAMELOOP_H_
+#define GAMELOOP_H_
+
+#include "CursesUtils.h"
+
+// The frame loop both curses games run. Each frame is timed by the profiler, the game is
+// stepped a whole frame at a time (see AdvanceFixedTimestep) and drawn once.
+//   isIdle()       true on screens that only wait for a key
+//   handleInput()  reads a key and returns it, 'q' ends the loop
+//   update(dt)     moves the game on one frame of dt clock() ticks
+//   draw()         draws the game into the screen buffer
+template<typename IsIdle, typename HandleInput, typename Update, typename Draw>
+void RunGameLoop(int framesPerSecond, FrameProfiler& profiler, IsIdle isIdle, HandleInput handleInput, Update update, Draw draw) {
+	const clock_t fixedTimestep = CLOCKS_PER_SEC / framesPerSecond;
+	FrameTimer frameTimer;
+
+	InitializeFrameTimer(frameTimer, framesPerSecond);
+	InitializeProfiler(profiler, frameTimer.frameDuration);
+
+	while (true) {
+		bool idle = isIdle(); // before the input that may leave the screen
+		bool frameDue = WaitForFrameOrInput(frameTimer, idle);
+
+		BeginProfileSection(profiler);
+		int input = handleInput();
+		EndProfileSection(profiler, PROFILE_INPUT);
+
+		if (input == 'q') {
+			break;
+		}
+		else if (input == PROFILER_TOGGLE_KEY) {
+			profiler.isOverlayVisible = !profiler.isOverlayVisible;
+		}
+
+		int steps = frameDue ? AdvanceFixedTimestep(frameTimer, idle) : 0;
+
+		// the games count frames, so a slow terminal costs drawn frames rather than game speed
+		if (steps > 0) {
+			BeginProfileSection(profiler);
+			for (int step = 0; step < steps; step++) {
+				update(fixedTimestep);
+			}
+			EndProfileSection(profiler, PROFILE_UPDATE);
+
+			BeginProfileSection(profiler);
+			ClearScreen();
+			draw();
+			DrawProfilerOverlay(profiler, 1, 1);
+			EndProfileSection(profiler, PROFILE_DRAW);
+
+			BeginProfileSection(profiler);
+			RefreshScreen();
+			EndProfileSection(profiler, PROFILE_REFRESH);
+
+			EndProfiledFrame(profiler);
+		}
+	}
+}
+
+#endif
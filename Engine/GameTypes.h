@@ -0,0 +1,26 @@
+#ifndef GAMETYPES_H_
+#define GAMETYPES_H_
+
+// What every curses game here is made of: positions and sizes in character cells,
+// and the screens a game goes through.
+
+struct Position {
+	int x;
+	int y;
+};
+
+struct Size {
+	int width;
+	int height;
+};
+
+enum GameState {
+	GS_INTRO = 0,
+	GS_HIGH_SCORES,
+	GS_PLAY,
+	GS_PLAYER_DEAD,
+	GS_WAIT,
+	GS_GAME_OVER
+};
+
+#endif
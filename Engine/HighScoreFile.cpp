@@ -0,0 +1,152 @@
+#include "HighScoreFile.h"
+#include "BinaryFile.h"
+#include <algorithm>
+#include <fstream>
+
+// File layout, all numbers little endian:
+//   header: magic "HSCR", version (2 bytes), number of records (2 bytes), FNV-1a of the records (4 bytes)
+//   record: score (4 bytes), name padded with '\0' (HIGH_SCORE_NAME_SIZE bytes)
+const char HIGH_SCORE_MAGIC[4] = { 'H', 'S', 'C', 'R' };
+
+enum {
+	HEADER_SIZE = 12,
+	RECORD_SIZE = 4 + HIGH_SCORE_NAME_SIZE,
+	MAX_RECORDS = 0xFFFF
+};
+
+void InitHighScoreTable(HighScoreTable& table, int maxScores, bool isBestScorePerName, const char* fileName, const char* legacyFileName) {
+	table.scores.clear();
+	table.maxScores = maxScores;
+	table.isBestScorePerName = isBestScorePerName;
+	table.fileName = fileName;
+	table.legacyFileName = legacyFileName;
+}
+
+void LoadHighScores(HighScoreTable& table) {
+	if (table.fileName != NULL && LoadHighScoreFile(table, table.fileName, table.maxScores)) {
+		return;
+	}
+	if (table.legacyFileName != NULL) {
+		LoadLegacyHighScoreFile(table, table.legacyFileName, table.maxScores);
+	}
+}
+
+int AddHighScore(HighScoreTable& table, int score, const std::string& name) {
+	Score highScore;
+	highScore.score = score;
+	highScore.name = name;
+
+	if (table.isBestScorePerName) {
+		for (size_t i = 0; i < table.scores.size(); i++) {
+			if (table.scores[i].name == name) {
+				if (score <= table.scores[i].score) {
+					return -1;
+				}
+				table.scores.erase(table.scores.begin() + i);
+				break;
+			}
+		}
+	}
+
+	int index = InsertHighScore(table, highScore, table.maxScores);
+	if (index != -1 && table.fileName != NULL) {
+		SaveHighScoreFile(table, table.fileName);
+	}
+
+	return index;
+}
+
+bool ScoreCompare(const Score& score1, const Score& score2) {
+	return score1.score > score2.score;
+}
+
+int InsertHighScore(HighScoreTable& table, const Score& score, int maxScores) {
+	// after any equal score, so the one that got there first stays ahead
+	std::vector<Score>::iterator place = std::upper_bound(table.scores.begin(), table.scores.end(), score, ScoreCompare);
+	int index = int(place - table.scores.begin());
+
+	if (index >= maxScores) {
+		return -1;
+	}
+
+	table.scores.insert(place, score);
+	if (int(table.scores.size()) > maxScores) {
+		table.scores.resize(maxScores);
+	}
+
+	return index;
+}
+
+bool SaveHighScoreFile(const HighScoreTable& table, const char* fileName) {
+	size_t numberOfRecords = std::min<size_t>(table.scores.size(), MAX_RECORDS);
+	std::vector<unsigned char> bytes(HEADER_SIZE + numberOfRecords * RECORD_SIZE, 0);
+
+	for (size_t i = 0; i < numberOfRecords; i++) {
+		unsigned char* record = &bytes[HEADER_SIZE + i * RECORD_SIZE];
+		const std::string& name = table.scores[i].name;
+
+		PutUint32(record, unsigned(table.scores[i].score));
+		std::copy(name.begin(), name.begin() + std::min<size_t>(name.size(), HIGH_SCORE_NAME_SIZE), record + 4);
+	}
+
+	std::copy(HIGH_SCORE_MAGIC, HIGH_SCORE_MAGIC + 4, bytes.begin());
+	PutUint16(&bytes[4], HIGH_SCORE_FILE_VERSION);
+	PutUint16(&bytes[6], unsigned(numberOfRecords));
+	PutUint32(&bytes[8], GetChecksum(&bytes[HEADER_SIZE], numberOfRecords * RECORD_SIZE));
+
+	return WriteBinaryFile(fileName, bytes);
+}
+
+bool LoadHighScoreFile(HighScoreTable& table, const char* fileName, int maxScores) {
+	std::ifstream inFile(fileName, std::ios::binary);
+	unsigned char header[HEADER_SIZE];
+
+	if (!inFile.is_open() || !inFile.read(reinterpret_cast<char*>(header), HEADER_SIZE)) {
+		return false;
+	}
+
+	if (!std::equal(HIGH_SCORE_MAGIC, HIGH_SCORE_MAGIC + 4, header) || GetUint16(&header[4]) != HIGH_SCORE_FILE_VERSION) {
+		return false;
+	}
+
+	size_t numberOfRecords = GetUint16(&header[6]);
+	std::vector<unsigned char> records(numberOfRecords * RECORD_SIZE);
+
+	if (numberOfRecords > 0 && !inFile.read(reinterpret_cast<char*>(&records[0]), std::streamsize(records.size()))) {
+		return false;
+	}
+
+	if (GetChecksum(records.empty() ? NULL : &records[0], records.size()) != GetUint32(&header[8])) {
+		return false;
+	}
+
+	table.scores.clear();
+	for (size_t i = 0; i < numberOfRecords; i++) {
+		const unsigned char* record = &records[i * RECORD_SIZE];
+		const char* name = reinterpret_cast<const char*>(record + 4);
+		Score score;
+
+		score.score = int(GetUint32(record));
+		score.name.assign(name, std::find(name, name + HIGH_SCORE_NAME_SIZE, '\0'));
+
+		InsertHighScore(table, score, maxScores); // a table saved with a bigger maximum still fits
+	}
+
+	return true;
+}
+
+bool LoadLegacyHighScoreFile(HighScoreTable& table, const char* fileName, int maxScores) {
+	std::ifstream inFile(fileName);
+	Score score;
+
+	if (!inFile.is_open()) {
+		return false;
+	}
+
+	table.scores.clear();
+	while (inFile >> score.name >> score.score) {
+		InsertHighScore(table, score, maxScores);
+	}
+
+	return true;
+}
@@ -0,0 +1,44 @@
+#ifndef HIGHSCOREFILE_H_
+#define HIGHSCOREFILE_H_
+
+#include <vector>
+#include <string>
+
+// High scores are kept in a small binary file: a header with a checksum, then one
+// fixed size record per score, best first. A new file is written next to the old
+// one and renamed over it, so dying halfway through a save never leaves a broken table.
+
+enum {
+	HIGH_SCORE_NAME_SIZE = 12, // bytes for a name in a record, longer names are cut
+	HIGH_SCORE_FILE_VERSION = 1
+};
+
+struct Score {
+	int score;
+	std::string name;
+};
+
+struct HighScoreTable {
+	std::vector<Score> scores; // best first, never more than maxScores
+	int maxScores;
+	bool isBestScorePerName; // a name is only in the table once, with its best score
+	const char* fileName; // NULL keeps the table in memory only
+	const char* legacyFileName; // read when fileName can't be, NULL if there is none
+};
+
+void InitHighScoreTable(HighScoreTable& table, int maxScores, bool isBestScorePerName, const char* fileName, const char* legacyFileName);
+void LoadHighScores(HighScoreTable& table);
+// Saves the table when the score makes it in. Returns where it went, or -1.
+int AddHighScore(HighScoreTable& table, int score, const std::string& name);
+
+bool ScoreCompare(const Score& score1, const Score& score2);
+// Puts the score in its place and drops whatever falls off the end. Returns its index, or -1 if it didn't make the table.
+int InsertHighScore(HighScoreTable& table, const Score& score, int maxScores);
+
+bool SaveHighScoreFile(const HighScoreTable& table, const char* fileName);
+// False if the file is missing, from another version or fails its checksum
+bool LoadHighScoreFile(HighScoreTable& table, const char* fileName, int maxScores);
+// The old "name score" text file, read once so existing tables carry over
+bool LoadLegacyHighScoreFile(HighScoreTable& table, const char* fileName, int maxScores);
+
+#endif
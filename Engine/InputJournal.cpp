@@ -0,0 +1,141 @@
+#include "InputJournal.h"
+#include "BinaryFile.h"
+#include <algorithm>
+
+// File layout, all numbers little endian:
+//   header: magic "IJRN", version (2 bytes), window width and height (2 bytes each), seed (4 bytes),
+//           number of frames (4 bytes), number of entries (4 bytes), FNV-1a of the entries (4 bytes)
+//   entry:  frames since the previous entry, then the key, each as a varint (7 bits a byte, low bits first).
+// Most keys come within a few seconds of the last one and are plain characters or arrows,
+// so an entry is usually two or three bytes.
+const char INPUT_JOURNAL_MAGIC[4] = { 'I', 'J', 'R', 'N' };
+
+enum {
+	JOURNAL_HEADER_SIZE = 26,
+	MAX_VARINT_SIZE = 5
+};
+
+void PutVarint(std::vector<unsigned char>& bytes, unsigned int value);
+bool GetVarint(const std::vector<unsigned char>& bytes, size_t& position, unsigned int& value);
+
+void InitInputJournal(InputJournal& journal, unsigned int seed, const Size& windowSize) {
+	journal.seed = seed;
+	journal.windowSize = windowSize;
+	journal.numberOfFrames = 0;
+	journal.entries.clear();
+	journal.replayPosition = 0;
+}
+
+void RecordInput(InputJournal& journal, int key) {
+	if (key == JOURNAL_NO_INPUT) {
+		return;
+	}
+
+	JournalEntry entry;
+	entry.frame = journal.numberOfFrames;
+	entry.key = key;
+	journal.entries.push_back(entry);
+}
+
+void RecordFrame(InputJournal& journal) {
+	journal.numberOfFrames++;
+}
+
+int NextReplayInput(InputJournal& journal, unsigned int frame) {
+	if (journal.replayPosition < journal.entries.size() && journal.entries[journal.replayPosition].frame <= frame) {
+		return journal.entries[journal.replayPosition++].key;
+	}
+
+	return JOURNAL_NO_INPUT;
+}
+
+bool SaveInputJournal(const InputJournal& journal, const char* fileName) {
+	std::vector<unsigned char> bytes(JOURNAL_HEADER_SIZE, 0);
+	unsigned int lastFrame = 0;
+
+	bytes.reserve(JOURNAL_HEADER_SIZE + journal.entries.size() * 3);
+	for (size_t i = 0; i < journal.entries.size(); i++) {
+		PutVarint(bytes, journal.entries[i].frame - lastFrame);
+		PutVarint(bytes, unsigned(journal.entries[i].key));
+		lastFrame = journal.entries[i].frame;
+	}
+
+	std::copy(INPUT_JOURNAL_MAGIC, INPUT_JOURNAL_MAGIC + 4, bytes.begin());
+	PutUint16(&bytes[4], INPUT_JOURNAL_VERSION);
+	PutUint16(&bytes[6], unsigned(journal.windowSize.width));
+	PutUint16(&bytes[8], unsigned(journal.windowSize.height));
+	PutUint32(&bytes[10], journal.seed);
+	PutUint32(&bytes[14], journal.numberOfFrames);
+	PutUint32(&bytes[18], unsigned(journal.entries.size()));
+	PutUint32(&bytes[22], GetChecksum(&bytes[JOURNAL_HEADER_SIZE], bytes.size() - JOURNAL_HEADER_SIZE));
+
+	return WriteBinaryFile(fileName, bytes);
+}
+
+bool LoadInputJournal(InputJournal& journal, const char* fileName) {
+	std::vector<unsigned char> bytes;
+
+	if (!ReadBinaryFile(fileName, bytes) || bytes.size() < JOURNAL_HEADER_SIZE) {
+		return false;
+	}
+
+	if (!std::equal(INPUT_JOURNAL_MAGIC, INPUT_JOURNAL_MAGIC + 4, bytes.begin()) || GetUint16(&bytes[4]) != INPUT_JOURNAL_VERSION) {
+		return false;
+	}
+
+	if (GetChecksum(&bytes[0] + JOURNAL_HEADER_SIZE, bytes.size() - JOURNAL_HEADER_SIZE) != GetUint32(&bytes[22])) {
+		return false;
+	}
+
+	Size windowSize;
+	windowSize.width = int(GetUint16(&bytes[6]));
+	windowSize.height = int(GetUint16(&bytes[8]));
+	InitInputJournal(journal, GetUint32(&bytes[10]), windowSize);
+	journal.numberOfFrames = GetUint32(&bytes[14]);
+
+	unsigned int numberOfEntries = GetUint32(&bytes[18]);
+	size_t position = JOURNAL_HEADER_SIZE;
+	unsigned int frame = 0;
+
+	// every entry is at least two bytes, so a bad count can't make us reserve more than the file holds
+	journal.entries.reserve(std::min<size_t>(numberOfEntries, (bytes.size() - JOURNAL_HEADER_SIZE) / 2));
+	for (unsigned int i = 0; i < numberOfEntries; i++) {
+		unsigned int frameDelta;
+		unsigned int key;
+
+		if (!GetVarint(bytes, position, frameDelta) || !GetVarint(bytes, position, key)) {
+			return false;
+		}
+
+		frame += frameDelta;
+		JournalEntry entry;
+		entry.frame = frame;
+		entry.key = int(key);
+		journal.entries.push_back(entry);
+	}
+
+	return position == bytes.size();
+}
+
+void PutVarint(std::vector<unsigned char>& bytes, unsigned int value) {
+	while (value >= 0x80) {
+		bytes.push_back((unsigned char)((value & 0x7F) | 0x80));
+		value >>= 7;
+	}
+	bytes.push_back((unsigned char)value);
+}
+
+bool GetVarint(const std::vector<unsigned char>& bytes, size_t& position, unsigned int& value) {
+	value = 0;
+
+	for (int i = 0; i < MAX_VARINT_SIZE && position < bytes.size(); i++) {
+		unsigned char byte = bytes[position++];
+		value |= unsigned(byte & 0x7F) << (7 * i);
+
+		if ((byte & 0x80) == 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
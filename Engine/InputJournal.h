@@ -0,0 +1,41 @@
+#ifndef INPUTJOURNAL_H_
+#define INPUTJOURNAL_H_
+
+#include <vector>
+#include <cstddef>
+#include "GameTypes.h"
+
+// Every key a game read, with the number of updates that had run before it, plus what the
+// game was started with. A game that only takes randomness from the seed and time from
+// the fixed timestep does exactly the same again when the keys are fed back at the same
+// frames, so a recorded session can be replayed headless as fast as the update can run.
+
+enum {
+	INPUT_JOURNAL_VERSION = 1,
+	JOURNAL_NO_INPUT = -1 // same as curses' ERR, what NextReplayInput gives when the frame has no more keys
+};
+
+struct JournalEntry {
+	unsigned int frame; // updates run before the key was read
+	int key;
+};
+
+struct InputJournal {
+	unsigned int seed;
+	Size windowSize;
+	unsigned int numberOfFrames; // updates run so far, or in the whole session once loaded
+	std::vector<JournalEntry> entries; // in the order the keys were read
+	size_t replayPosition;
+};
+
+void InitInputJournal(InputJournal& journal, unsigned int seed, const Size& windowSize);
+void RecordInput(InputJournal& journal, int key); // ignores JOURNAL_NO_INPUT
+void RecordFrame(InputJournal& journal);
+// The next key read before update number frame, or JOURNAL_NO_INPUT once there are none left for it
+int NextReplayInput(InputJournal& journal, unsigned int frame);
+
+bool SaveInputJournal(const InputJournal& journal, const char* fileName);
+// False if the file is missing, from another version or fails its checksum
+bool LoadInputJournal(InputJournal& journal, const char* fileName);
+
+#endif
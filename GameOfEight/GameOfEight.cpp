@@ -1,30 +1,82 @@
 #include <iostream>
+#include <cstdlib>
+#include <cctype>
 
-void PlayGame();
+#include "GameSolver.h"
+
+void PlayGame(const GameRules& rules, const GameSolution& solution, bool isPlayerTwoComputer);
 bool WantToPlayAgain();
-int GetNumber(int lastPlayerChoose);
+bool GetYesNo(const char* prompt);
+bool ParseRules(GameRules& rules, int argc, char* argv[]);
+int GetNumber(const GameRules& rules, int lastPlayerChoose);
 
 const int IGNORE_CHAR = 256;
-int main()
+
+// GameOfEight [starting number] [move ...], e.g. "GameOfEight 1000000 1 2 3 5"
+int main(int argc, char* argv[])
 {
+    GameRules rules;
+    if (!ParseRules(rules, argc, argv)) {
+        std::cout << "Usage: GameOfEight [starting number] [move ...]" << std::endl;
+        return 1;
+    }
+
+    // solved once here, every computer move after this is a table lookup
+    GameSolution solution;
+    SolveGame(solution, rules);
+
     std::cout << "----------This is Game of Eight----------" << '\n';
+    bool isPlayerTwoComputer = GetYesNo("Would you like to play against the computer? (Y/N):");
     do {
-        PlayGame();
+        PlayGame(rules, solution, isPlayerTwoComputer);
     } while (WantToPlayAgain());
     
 }
 
-void PlayGame() {
+bool ParseRules(GameRules& rules, int argc, char* argv[]) {
+    InitDefaultRules(rules);
+
+    if (argc > 1) {
+        rules.startingNumber = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        rules.moves.clear();
+        for (int i = 2; i < argc; i++) {
+            rules.moves.push_back(atoi(argv[i]));
+            if (rules.moves.back() <= 0) {
+                return false;
+            }
+        }
+    }
+
+    return rules.startingNumber > 0;
+}
+
+void PlayGame(const GameRules& rules, const GameSolution& solution, bool isPlayerTwoComputer) {
     bool playerOneTurn{ true };
     bool isGameOver{ false };
     int playerWin, lastPlayerChoose{ 0 }, choose;
-    int number{ 8 };
+    int number{ rules.startingNumber };
 
     do {
         std::cout << '\n';
         std::cout << "Player" << ((playerOneTurn) ? 1 : 2) << " Turn! \n";
         std::cout << "Current number is " << number << ". ";
-        choose = GetNumber(lastPlayerChoose);
+
+        if (GetBestMove(solution, number, lastPlayerChoose) == NO_MOVE) {
+            // only possible with a single move, which the other player just used
+            std::cout << "No number left to choose!" << std::endl;
+            playerWin = (playerOneTurn) ? 2 : 1;
+            break;
+        }
+
+        if (!playerOneTurn && isPlayerTwoComputer) {
+            choose = GetBestMove(solution, number, lastPlayerChoose);
+            std::cout << "Computer chooses " << choose << "." << std::endl;
+        }
+        else {
+            choose = GetNumber(rules, lastPlayerChoose);
+        }
         number -= choose;
         if (number == 0) {
             playerWin = (playerOneTurn) ? 1 : 2;
@@ -41,15 +93,15 @@ void PlayGame() {
     std::cout << "Game Over! Player" << playerWin << " Win." << std::endl;
 }
 
-bool IsValid(int input, int lastPlayerChoose) {
-    return input > 0 && input <= 3 && input != lastPlayerChoose;
-}
-
-int GetNumber(int lastPlayerChoose) {
+int GetNumber(const GameRules& rules, int lastPlayerChoose) {
     int input;
     bool failure;
 
-    std::cout << "Choose number from 1 to 3:";
+    std::cout << "Choose number from";
+    for (size_t i = 0; i < rules.moves.size(); i++) {
+        std::cout << ((i == 0) ? " " : ", ") << rules.moves[i];
+    }
+    std::cout << ":";
     do {
         failure = false;
         std::cin >> input;
@@ -60,7 +112,7 @@ int GetNumber(int lastPlayerChoose) {
             std::cout << "Input error! Please try again." << std::endl;
             failure = true;
         }
-        else if (!IsValid(input, lastPlayerChoose)) {
+        else if (!IsValidMove(rules, input, lastPlayerChoose)) {
             std::cin.clear();
             std::cin.ignore(IGNORE_CHAR, '\n');
             std::cout << "Nope! Choose another number:";
@@ -72,13 +124,17 @@ int GetNumber(int lastPlayerChoose) {
 }
 
 bool WantToPlayAgain() {
+    return GetYesNo("Would you like to play again? (Y/N):");
+}
+
+bool GetYesNo(const char* prompt) {
     char input;
     bool failure;
 
     do {
         failure = false;
 
-        std::cout << "Would you like to play again? (Y/N):";
+        std::cout << prompt;
         std::cin >> input;
 
         if (std::cin.fail()){
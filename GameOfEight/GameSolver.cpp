@@ -0,0 +1,93 @@
+#include "GameSolver.h"
+
+#include <algorithm>
+
+// Each state is one byte: the index of the move to play in the low bits, and
+// WIN_FLAG when that move wins. NO_MOVE_INDEX means the player has no legal move.
+const unsigned char WIN_FLAG = 0x80;
+const unsigned char MOVE_INDEX_MASK = 0x7F;
+const unsigned char NO_MOVE_INDEX = 0x7F;
+const int MAX_MOVES = 0x7E;
+
+unsigned char GetState(const GameSolution& solution, int number, int lastPlayerChoose);
+
+void InitDefaultRules(GameRules& rules) {
+    rules.startingNumber = DEFAULT_STARTING_NUMBER;
+    rules.moves = { 1, 2, 3 };
+}
+
+bool IsValidMove(const GameRules& rules, int input, int lastPlayerChoose) {
+    return input != lastPlayerChoose && std::find(rules.moves.begin(), rules.moves.end(), input) != rules.moves.end();
+}
+
+void SolveGame(GameSolution& solution, const GameRules& rules) {
+    solution.moves = rules.moves;
+    std::sort(solution.moves.begin(), solution.moves.end());
+    solution.moves.erase(std::unique(solution.moves.begin(), solution.moves.end()), solution.moves.end());
+    if (solution.moves.size() > MAX_MOVES) {
+        solution.moves.resize(MAX_MOVES);
+    }
+
+    int numberOfMoves = static_cast<int>(solution.moves.size());
+    int stride = numberOfMoves + 1;
+
+    solution.moveIndex.assign(solution.moves.empty() ? 1 : solution.moves.back() + 1, NO_MOVE);
+    for (int i = 0; i < numberOfMoves; i++) {
+        solution.moveIndex[solution.moves[i]] = i;
+    }
+
+    solution.maxNumber = rules.startingNumber;
+    solution.states.assign(static_cast<size_t>(rules.startingNumber + 1) * stride, NO_MOVE_INDEX);
+
+    // A move only ever makes the number smaller, so solving from the bottom up means
+    // every position a move leads to is already known
+    for (int number = 1; number <= rules.startingNumber; number++) {
+        for (int last = -1; last < numberOfMoves; last++) {
+            unsigned char state = NO_MOVE_INDEX;
+
+            for (int i = 0; i < numberOfMoves; i++) {
+                int move = solution.moves[i];
+                if (i == last) {
+                    continue;
+                }
+
+                if (move == number) {
+                    state = WIN_FLAG | i; // hitting zero exactly wins
+                    break;
+                }
+                else if (move < number) {
+                    if ((solution.states[static_cast<size_t>(number - move) * stride + i + 1] & WIN_FLAG) == 0) {
+                        state = WIN_FLAG | i; // leaves the opponent in a lost position
+                        break;
+                    }
+                    if (state == NO_MOVE_INDEX || solution.moves[state] > number) {
+                        state = static_cast<unsigned char>(i); // loses, but keeps the game going
+                    }
+                }
+                else if (state == NO_MOVE_INDEX) {
+                    state = static_cast<unsigned char>(i); // going below zero loses straight away
+                }
+            }
+
+            solution.states[static_cast<size_t>(number) * stride + last + 1] = state;
+        }
+    }
+}
+
+unsigned char GetState(const GameSolution& solution, int number, int lastPlayerChoose) {
+    if (number <= 0 || number > solution.maxNumber) {
+        return NO_MOVE_INDEX;
+    }
+
+    int last = (lastPlayerChoose > 0 && lastPlayerChoose < int(solution.moveIndex.size())) ? solution.moveIndex[lastPlayerChoose] : NO_MOVE;
+    return solution.states[static_cast<size_t>(number) * (solution.moves.size() + 1) + last + 1];
+}
+
+bool IsWinningPosition(const GameSolution& solution, int number, int lastPlayerChoose) {
+    return (GetState(solution, number, lastPlayerChoose) & WIN_FLAG) != 0;
+}
+
+int GetBestMove(const GameSolution& solution, int number, int lastPlayerChoose) {
+    unsigned char state = GetState(solution, number, lastPlayerChoose);
+    return (state == NO_MOVE_INDEX) ? NO_MOVE : solution.moves[state & MOVE_INDEX_MASK];
+}
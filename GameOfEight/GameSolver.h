@@ -0,0 +1,33 @@
+#pragma once
+#ifndef __GAME_SOLVER_H__
+#define __GAME_SOLVER_H__
+
+#include <vector>
+
+// Every position of the game is (number left, what the opponent just chose). The
+// solver works out, once, which of them are won for the player to move and how.
+
+const int DEFAULT_STARTING_NUMBER = 8;
+const int NO_MOVE = -1;
+
+struct GameRules {
+    int startingNumber;
+    std::vector<int> moves; // numbers a player may take away, never the one the opponent just took
+};
+
+struct GameSolution {
+    std::vector<int> moves;
+    std::vector<int> moveIndex; // move value -> position in moves, NO_MOVE if not a move
+    int maxNumber;
+    std::vector<unsigned char> states; // [number * (moves + 1) + last move index + 1], see GameSolver.cpp
+};
+
+void InitDefaultRules(GameRules& rules);
+bool IsValidMove(const GameRules& rules, int input, int lastPlayerChoose);
+
+void SolveGame(GameSolution& solution, const GameRules& rules);
+bool IsWinningPosition(const GameSolution& solution, int number, int lastPlayerChoose);
+// The winning move when there is one, otherwise one that doesn't lose straight away if it can
+int GetBestMove(const GameSolution& solution, int number, int lastPlayerChoose);
+
+#endif
@@ -3,32 +3,97 @@
 
 #include <iostream>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <vector>
 
+enum GuessStrategy {
+    GS_BINARY = 0, // always the middle of what is left
+    GS_SKEWED,     // a third of the way in, worse on average but still logarithmic
+    GS_RANDOM,     // anywhere in what is left
+    NUM_STRATEGIES
+};
 
-void PlayGame();
+const char* STRATEGY_NAMES[NUM_STRATEGIES] = { "binary", "skewed", "random" };
+
+const int MAX_TRIES = 128; // the histogram lumps anything longer into the last bucket
+
+struct EvaluationResult {
+    unsigned long long secrets;
+    unsigned long long totalTries;
+    unsigned long long triesCount[MAX_TRIES + 1]; // how many secrets took that many tries
+};
+
+void PlayGame(long long low, long long high);
+void PlayComputerGuesses(long long low, long long high);
 bool WantToPlayAgain();
-int GetGuess(int numberOfTries);
+bool WantComputerToGuess();
+long long GetGuess(int numberOfTries);
+char GetAnswer(long long guess);
+int GetMaxTries(long long low, long long high);
+long long GetRandomNumber(long long low, long long high);
+
+long long GetNextGuess(GuessStrategy strategy, long long low, long long high, unsigned long long& randomState);
+int CountTries(GuessStrategy strategy, long long low, long long high, long long secret, unsigned long long& randomState);
+void EvaluateSecrets(GuessStrategy strategy, long long low, long long high, long long first, long long last, unsigned long long seed, EvaluationResult& result);
+int RunEvaluation(long long low, long long high, int strategy, int numberOfThreads);
 
 const int IGNORE_CHARS = 256;
-int main()
+const long long DEFAULT_LOW = 1;
+const long long DEFAULT_HIGH = 100;
+const long long MAX_RANGE_SIZE = 1LL << 32;
+
+// Guessing_Number [low high]
+// Guessing_Number --evaluate [low high] [binary|skewed|random|all] [threads]
+int main(int argc, char* argv[])
 {
+    bool isEvaluation = argc > 1 && strcmp(argv[1], "--evaluate") == 0;
+    int firstArgument = isEvaluation ? 2 : 1;
+    long long low = (argc > firstArgument + 1) ? atoll(argv[firstArgument]) : DEFAULT_LOW;
+    long long high = (argc > firstArgument + 1) ? atoll(argv[firstArgument + 1]) : DEFAULT_HIGH;
+
+    if (low > high || high - low + 1 > MAX_RANGE_SIZE) {
+        std::cout << "The range must hold between 1 and " << MAX_RANGE_SIZE << " numbers." << std::endl;
+        return 1;
+    }
+
+    if (isEvaluation) {
+        int strategy = NUM_STRATEGIES; // all of them
+        if (argc > 4) {
+            for (int i = 0; i < NUM_STRATEGIES; i++) {
+                if (strcmp(argv[4], STRATEGY_NAMES[i]) == 0) {
+                    strategy = i;
+                }
+            }
+        }
+        return RunEvaluation(low, high, strategy, (argc > 5) ? atoi(argv[5]) : 0);
+    }
+
     std::cout << "----------This is the number gusser game----------\n";
     srand(time(NULL));
     do {
-        PlayGame();
+        if (WantComputerToGuess()) {
+            PlayComputerGuesses(low, high);
+        }
+        else {
+            PlayGame(low, high);
+        }
     } while (WantToPlayAgain());
     
     return 0;
 }
 
-void PlayGame() {
-    int iSecret, iGeuss, count;
+void PlayGame(long long low, long long high) {
+    long long iSecret, iGeuss;
+    int count;
 
-    srand(time(NULL));
-
-    iSecret = rand() % 100 + 1;
-    count = 7;
+    iSecret = GetRandomNumber(low, high);
+    count = GetMaxTries(low, high);
+    std::cout << "The secret number is between " << low << " and " << high << ".\n";
     do {
         iGeuss = GetGuess(count);
         if (iSecret == iGeuss) {
@@ -48,9 +113,57 @@ void PlayGame() {
     std::cout << "The secret number is " << iSecret << std::endl;
 }
 
-int GetGuess(int numberOfTries)
+//The player keeps a number in mind and the computer halves the range with every guess
+void PlayComputerGuesses(long long low, long long high) {
+    int count = 0;
+
+    std::cout << "Think of a number between " << low << " and " << high << ". ";
+    std::cout << "I will find it in at most " << GetMaxTries(low, high) << " guesses.\n";
+
+    while (low <= high) {
+        long long guess = low + (high - low) / 2;
+        ++count;
+
+        char answer = GetAnswer(guess);
+        if (answer == 'c') {
+            std::cout << "Got it in " << count << ((count == 1) ? " guess!" : " guesses!") << std::endl;
+            return;
+        }
+        else if (answer == 'h') {
+            low = guess + 1;
+        }
+        else {
+            high = guess - 1;
+        }
+    }
+
+    std::cout << "That can't be right, there is no number left. Did you change your mind?" << std::endl;
+}
+
+//Enough tries for a binary search to find any number in the range
+int GetMaxTries(long long low, long long high)
 {
-    int guess;
+    int tries = 0;
+    for (long long size = high - low + 1; size > 0; size >>= 1) {
+        ++tries;
+    }
+    return tries;
+}
+
+//rand() may only give 15 bits, so stack calls until the whole range is covered
+long long GetRandomNumber(long long low, long long high)
+{
+    unsigned long long size = high - low + 1;
+    unsigned long long value = 0;
+    for (unsigned long long covered = 1; covered < size; covered *= (unsigned long long)RAND_MAX + 1) {
+        value = value * ((unsigned long long)RAND_MAX + 1) + rand();
+    }
+    return low + (long long)(value % size);
+}
+
+long long GetGuess(int numberOfTries)
+{
+    long long guess;
     bool failure;
 
     do
@@ -73,6 +186,67 @@ int GetGuess(int numberOfTries)
     return guess;
 }
 
+char GetAnswer(long long guess)
+{
+    char input;
+    bool failure;
+    do {
+        failure = false;
+
+        std::cout << "Is it " << guess << "? (h = higher, l = lower, c = correct):";
+        std::cin >> input;
+
+        if (std::cin.fail())
+        {
+            std::cin.clear();
+            std::cin.ignore(IGNORE_CHARS, '\n');
+            std::cout << "Input Error! Please try again." << std::endl;
+            failure = true;
+        }
+        else
+        {
+            std::cin.ignore(IGNORE_CHARS, '\n');
+            input = tolower(input);
+            if (input != 'h' && input != 'l' && input != 'c')
+            {
+                std::cout << "Please answer h, l or c." << std::endl;
+                failure = true;
+            }
+        }
+
+    } while (failure);
+
+    return input;
+}
+
+bool WantComputerToGuess()
+{
+    char input;
+    bool failure;
+    do {
+        failure = false;
+
+        std::cout << "Who should guess? (y = you, c = computer):";
+        std::cin >> input;
+
+        if (std::cin.fail())
+        {
+            std::cin.clear();
+            std::cin.ignore(IGNORE_CHARS, '\n');
+            std::cout << "Input Error! Please try again." << std::endl;
+            failure = true;
+        }
+        else
+        {
+            std::cin.ignore(IGNORE_CHARS, '\n');
+            input = tolower(input);
+        }
+
+    } while (failure);
+
+    return input == 'c';
+}
+
 bool WantToPlayAgain()
 {
     char input;
@@ -99,4 +273,118 @@ bool WantToPlayAgain()
     } while (failure);
 
     return input == 'y';
-}
\ No newline at end of file
+}
+
+long long GetNextGuess(GuessStrategy strategy, long long low, long long high, unsigned long long& randomState)
+{
+    switch (strategy) {
+    case GS_SKEWED:
+        return low + (high - low) / 3;
+
+    case GS_RANDOM:
+        // xorshift64, every thread has its own state
+        randomState ^= randomState << 13;
+        randomState ^= randomState >> 7;
+        randomState ^= randomState << 17;
+        // scale the top 32 bits onto the range, a multiply is much cheaper than a 64 bit divide
+        return low + (long long)(((randomState >> 32) * (unsigned long long)(high - low + 1)) >> 32);
+
+    default:
+        return low + (high - low) / 2;
+    }
+}
+
+int CountTries(GuessStrategy strategy, long long low, long long high, long long secret, unsigned long long& randomState)
+{
+    int tries = 1;
+    long long guess = GetNextGuess(strategy, low, high, randomState);
+
+    while (guess != secret) {
+        // written as selects so the compiler can avoid a hard to predict branch
+        low = (secret > guess) ? guess + 1 : low;
+        high = (secret < guess) ? guess - 1 : high;
+        guess = GetNextGuess(strategy, low, high, randomState);
+        ++tries;
+    }
+
+    return tries;
+}
+
+void EvaluateSecrets(GuessStrategy strategy, long long low, long long high, long long first, long long last, unsigned long long seed, EvaluationResult& result)
+{
+    unsigned long long randomState = (seed == 0) ? 1 : seed;
+
+    result.secrets = 0;
+    result.totalTries = 0;
+    std::fill(result.triesCount, result.triesCount + MAX_TRIES + 1, 0ULL);
+
+    for (long long secret = first; secret <= last; secret++) {
+        int tries = CountTries(strategy, low, high, secret, randomState);
+
+        result.secrets++;
+        result.totalTries += tries;
+        result.triesCount[std::min(tries, MAX_TRIES)]++;
+    }
+}
+
+//Plays every secret in the range against each strategy and prints how many tries they took
+int RunEvaluation(long long low, long long high, int strategy, int numberOfThreads)
+{
+    if (numberOfThreads <= 0) {
+        numberOfThreads = std::max(1, int(std::thread::hardware_concurrency()));
+    }
+
+    long long rangeSize = high - low + 1;
+    unsigned long long baseSeed = (unsigned long long)time(NULL);
+
+    std::cout << "secrets: " << low << " - " << high << " (" << rangeSize << ")\n";
+    std::cout << "threads: " << numberOfThreads << "\n";
+
+    for (int s = 0; s < NUM_STRATEGIES; s++) {
+        if (strategy != NUM_STRATEGIES && strategy != s) {
+            continue;
+        }
+
+        std::vector<EvaluationResult> results(numberOfThreads);
+        std::vector<std::thread> threads;
+
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+        long long first = low;
+        for (int t = 0; t < numberOfThreads; t++) {
+            //split the secrets as evenly as possible between the threads
+            long long secretsForThread = rangeSize / numberOfThreads + (t < rangeSize % numberOfThreads ? 1 : 0);
+            threads.push_back(std::thread(EvaluateSecrets, GuessStrategy(s), low, high, first, first + secretsForThread - 1,
+                baseSeed + 7919ULL * (t + 1), std::ref(results[t])));
+            first += secretsForThread;
+        }
+
+        EvaluationResult total = {};
+        for (int t = 0; t < numberOfThreads; t++) {
+            threads[t].join();
+
+            total.secrets += results[t].secrets;
+            total.totalTries += results[t].totalTries;
+            for (int tries = 0; tries <= MAX_TRIES; tries++) {
+                total.triesCount[tries] += results[t].triesCount[tries];
+            }
+        }
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+
+        std::cout << "\n" << STRATEGY_NAMES[s] << ":\n";
+        std::cout << "  mean tries:     " << double(total.totalTries) / std::max(total.secrets, 1ULL) << "\n";
+        std::cout << "  tries  secrets\n";
+        for (int tries = 1; tries <= MAX_TRIES; tries++) {
+            if (total.triesCount[tries] > 0) {
+                std::cout << "  " << ((tries == MAX_TRIES) ? ">=" : "  ") << tries << "    " << total.triesCount[tries] << "\n";
+            }
+        }
+        std::cout << "  elapsed:        " << elapsed.count() << " s\n";
+        if (elapsed.count() > 0.0) {
+            std::cout << "  secrets/second: " << total.secrets / elapsed.count() << "\n";
+        }
+    }
+
+    return 0;
+}
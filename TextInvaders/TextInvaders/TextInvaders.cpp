@@ -1,115 +1,179 @@
 #include "TextInvaders.h"
-#include "CursesUtils.h"
+#include "GameLoop.h"
 #include <cstring>
+#include <cstdint>
 #include <cstdlib>
+#include <cmath>
 #include <algorithm>
 #include <fstream>
+#include <iostream>
+#include <chrono>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
 
 using namespace std;
 
-void InitGame(Game& game);
+void InitGame(Game& game, const Size& windowSize);
 void InitPlayer(const Game& game, Player& player);
-void InitShields(const Game& game, Shield shields[], int numberOfShields);
 void InitAliens(const Game& game, AlienSwarm& aliens);
-void CleanUpShields(Shield shields[], int numberOfShields);
 
-int IsCollision(const Position& projectile, const Shield shields[], int numberOfShields, Position& shieldCollisionPoint);
+int IsCollision(const Game& game, const Position& projectile, const ShieldArena& shields, Position& shieldCollisionPoint);
+int GetShieldOwner(const Game& game, int x, int y);
 bool IsColission(const Player& player, const AlienSwarm& aliens, Position& alienCollisionPositionInArray);
+bool FindAlienAt(const AlienSwarm& aliens, const Position& position, Position& alienPositionInArray);
 bool IsColission(const Position& projectile, const Position& spritePosition, const Size& spriteSize);
-void ResolveShieldCollision(Shield shields[], int shieldIndex, const Position& shieldCollisionPoint);
+void ResolveShieldCollision(ShieldArena& shields, int shieldIndex, const Position& shieldCollisionPoint);
 int ResolveAlienCollison(AlienSwarm& aliens, const Position& hitPositionInAliensArray);
-void DestroyShields(const AlienSwarm& aliens, Shield shields[], int numberOfShields);
-void CollideShieldsWithAlien(Shield shields[], int numberOfShields, int alienPosX, int alienPosY, const Size& size);
+void DestroyShields(const Game& game, const AlienSwarm& aliens, ShieldArena& shields);
+void CollideShieldsWithAlien(const Game& game, ShieldArena& shields, int alienPosX, int alienPosY, const Size& size);
 
-int HandleInput(Game& game, Player& player, AlienSwarm& aliens, Shield shields[], int numberOfShields, HighScoreTable& table);
+int ProcessInput(int input, Game& game, Player& player, AlienSwarm& aliens, ShieldArena& shields, HighScoreTable& table);
 void PlayerShoot(Player& player);
-void UpdateGame(clock_t dt, Game& game, Player& player, Shield shields[], int numberOfShield, AlienSwarm& aliens, AlienUFO& ufo);
+void UpdateGame(clock_t dt, Game& game, Player& player, ShieldArena& shields, AlienSwarm& aliens, AlienUFO& ufo);
 void UpdateMissile(Player& player);
-bool UpdateAliens(Game& game, AlienSwarm& aliens, Player& player, Shield shields[], int numberOfShields);
-bool UpdateBombs(const Game& game, AlienSwarm& aliens, Player& player, Shield shield[], int numberOfShields);
+bool UpdateAliens(Game& game, AlienSwarm& aliens, Player& player, ShieldArena& shields);
+bool UpdateBombs(const Game& game, AlienSwarm& aliens, Player& player, ShieldArena& shields);
 void MovePlayer(const Game& game, Player& player, int dx);
 void FindEmptyRowAndColumns(const AlienSwarm& aliens, int& emptyColLeft, int& emptyColRight, int& emptyRowsBottom);
+void ClearExplodedAliens(AlienSwarm& aliens);
+AlienState GetAlienState(const AlienSwarm& aliens, int row, int col);
+int LowestBit(unsigned long long word);
+int HighestBit(unsigned long long word);
+int GetMaskWords(int numberOfBits);
+void FillMask(unsigned long long mask[], int numberOfBits);
+bool IsBitSet(const unsigned long long mask[], int bit);
+void ClearBit(unsigned long long mask[], int bit);
+bool IsMaskEmpty(const unsigned long long mask[], int numberOfWords);
+int HighestBit(const unsigned long long mask[], int numberOfWords);
+int CountBits(const unsigned long long mask[], int numberOfWords);
+int NthBit(const unsigned long long mask[], int numberOfWords, int n);
 bool ShouldShootBomb(const AlienSwarm& aliens);
 void ShootBomb(AlienSwarm& aliens, int columnToShoot);
 void PutUFOInPlay(Game& game, AlienUFO& ufo);
 void UpdateUFO(Game& game, AlienUFO& ufo);
 
-void DrawGame(const Game& game, const Player& player, Shield shields[], int numberOfShields, const AlienSwarm& aliens, AlienUFO& ufo, const HighScoreTable& table);
+bool IsIdleScreen(const Game& game);
+void DrawGame(const Game& game, const Player& player, ShieldArena& shields, const AlienSwarm& aliens, AlienUFO& ufo, const HighScoreTable& table);
 void DrawPlayer(const Player& player, const char* sprite[]);
-void DrawShields(const Shield shields[], int numberOfShields);
+void DrawShields(const ShieldArena& shields);
 void DrawAliens(const AlienSwarm& aliens);
+void DrawAlienRow(const AlienSwarm& aliens, const std::vector<unsigned long long>& rowMasks, int row, const SpriteStrip& strip, int frame);
 void DrawGameOverScreen(const Game& game);
 void DrawIntroScreen(const Game& game);
 void DrawUFO(const AlienUFO& ufo);
 void DrawHighScoreTable(const Game& game, const HighScoreTable& table);
 
-void ResetGame(Game& game, Player& player, AlienSwarm& aliens, Shield shields[], int numberOfShield);
-void ResetShields(const Game& game, Shield shields[], int numberOfShields);
+void ResetGame(Game& game, Player& player, AlienSwarm& aliens, ShieldArena& shields);
+void ResetShields(Game& game, ShieldArena& shields);
 void ResetPlayer(const Game& game, Player& player);
 void ResetMissile(Player& player);
 void ResetMovementTime(AlienSwarm& aliens);
 void ResetUFO(AlienUFO& ufo);
 void ResetGameOverPositionCursor(Game& game);
-void AddHighScore(HighScoreTable& table, int score, const string& name);
 
-bool ScoreCompare(const Score& score1, const Score& score2);
-void SaveHighScore(const HighScoreTable& table);
-void LoadHighScore(HighScoreTable& table);
 
-int main() {
-	srand(time(NULL));
+void SeedRandom(unsigned int seed);
+int GetRandom();
+void InitWaveConfig(WaveConfig& wave);
+int RunHeadless(long long numberOfFrames, unsigned int seed, const WaveConfig& wave, bool isStressTest);
+int RunReplay(const char* journalFile);
+unsigned long long UpdateChecksum(unsigned long long checksum, const Game& game, const Player& player, const AlienSwarm& aliens);
+int GetAutopilotInput(const Game& game);
+
+int main(int argc, char* argv[]) {
+	if (argc > 1 && strcmp(argv[1], "--headless") == 0) {
+		long long numberOfFrames = (argc > 2) ? atoll(argv[2]) : HEADLESS_DEFAULT_FRAMES;
+		unsigned int seed = (argc > 3) ? unsigned(strtoul(argv[3], nullptr, 10)) : HEADLESS_DEFAULT_SEED;
+		WaveConfig wave;
+		InitWaveConfig(wave);
+		return RunHeadless(numberOfFrames, seed, wave, false);
+	}
+	else if (argc > 1 && strcmp(argv[1], "--stress") == 0) {
+		// --stress [rows] [columns] [bombs] [frames] [seed]
+		WaveConfig wave;
+		InitWaveConfig(wave);
+		wave.numAlienRows = (argc > 2) ? max(1, atoi(argv[2])) : STRESS_ALIEN_ROWS;
+		wave.numAlienColumns = (argc > 3) ? max(1, atoi(argv[3])) : STRESS_ALIEN_COLUMNS;
+		wave.maxNumberOfBombs = (argc > 4) ? max(1, atoi(argv[4])) : STRESS_ALIEN_BOMBS;
+		long long numberOfFrames = (argc > 5) ? atoll(argv[5]) : STRESS_DEFAULT_FRAMES;
+		unsigned int seed = (argc > 6) ? unsigned(strtoul(argv[6], nullptr, 10)) : HEADLESS_DEFAULT_SEED;
+		return RunHeadless(numberOfFrames, seed, wave, true);
+	}
+	else if (argc > 1 && strcmp(argv[1], "--replay") == 0) {
+		return RunReplay((argc > 2) ? argv[2] : journalFilename);
+	}
+
+	// [--profile [file]] [--record [file]]
+	const char* profileFile = NULL;
+	const char* journalFile = NULL;
+	for (int i = 1; i < argc; i++) {
+		bool hasFileName = (i + 1 < argc) && argv[i + 1][0] != '-';
+		if (strcmp(argv[i], "--profile") == 0) {
+			profileFile = hasFileName ? argv[++i] : profileFilename;
+		}
+		else if (strcmp(argv[i], "--record") == 0) {
+			journalFile = hasFileName ? argv[++i] : journalFilename;
+		}
+	}
+
+	unsigned int seed = unsigned(time(NULL));
+	SeedRandom(seed);
 
 	Game game;
 	Player player;
-	Shield shields[NUM_SHIELDS];
 	AlienSwarm aliens;
 	AlienUFO ufo;
 	HighScoreTable table;
+	InputJournal journal;
 	
 	InitializeCurses(true);
-	InitGame(game);
+	InitGame(game, Size{ ScreenWidth(), ScreenHeight() });
+	InitInputJournal(journal, seed, game.windowSize);
 	game.level = 1;
+	ShieldArena shields(game.wave.numShields);
 	InitPlayer(game, player);
-	InitShields(game, shields, NUM_SHIELDS);
+	ResetShields(game, shields);
 	InitAliens(game, aliens);
 	ResetUFO(ufo);
-	LoadHighScore(table);
-
-	bool quit = false;
-	int input{ 0 };
-	clock_t lastTime = clock();
-
-	while (!quit) {
-		input = HandleInput(game, player, aliens, shields, NUM_SHIELDS, table);
-		if (input != 'q') {
+	InitHighScoreTable(table, MAX_HIGH_SCORES, false, filename, legacyFilename);
+	LoadHighScores(table);
 
-			clock_t currentTime = clock();
-			clock_t dt = currentTime - lastTime;
+	FrameProfiler profiler;
 
-			if (dt > CLOCKS_PER_SEC / FPS) {
-				lastTime = currentTime;
-
-				UpdateGame(dt, game, player, shields, NUM_SHIELDS, aliens, ufo);
-				ClearScreen();
-				DrawGame(game, player, shields, NUM_SHIELDS, aliens, ufo, table);
-				RefreshScreen();
+	RunGameLoop(FPS, profiler,
+		[&]() { return IsIdleScreen(game); },
+		[&]() {
+			int input = GetChar();
+			if (journalFile != NULL) {
+				RecordInput(journal, input);
 			}
-			
-		}
-		else {
-			quit = true;
-		}
-		
-	}
+			return ProcessInput(input, game, player, aliens, shields, table);
+		},
+		[&](clock_t dt) {
+			UpdateGame(dt, game, player, shields, aliens, ufo);
+			RecordFrame(journal);
+		},
+		[&]() { DrawGame(game, player, shields, aliens, ufo, table); });
 
-	CleanUpShields(shields, NUM_SHIELDS);
 	ShutdownCurses();
-	return 0;
+
+	int result = 0;
+	if (profileFile != NULL && !WriteProfilerCsv(profiler, profileFile)) {
+		cerr << "Could not write " << profileFile << endl;
+		result = 1;
+	}
+	if (journalFile != NULL && !SaveInputJournal(journal, journalFile)) {
+		cerr << "Could not write " << journalFile << endl;
+		result = 1;
+	}
+	return result;
 }
 
-void InitGame(Game& game) {
-	game.windowSize.width = ScreenWidth();
-	game.windowSize.height = ScreenHeight();
+void InitGame(Game& game, const Size& windowSize) {
+	game.windowSize = windowSize;
+	InitWaveConfig(game.wave);
 	game.currentState = GS_INTRO;
 	game.waitTimer = 0;
 	game.gameTimer = 0;
@@ -139,9 +203,7 @@ void ResetMissile(Player& player) {
 }
 
 
-int HandleInput(Game& game, Player& player, AlienSwarm& aliens, Shield shields[], int numberOfShields, HighScoreTable& table) {
-	int input = GetChar();
-
+int ProcessInput(int input, Game& game, Player& player, AlienSwarm& aliens, ShieldArena& shields, HighScoreTable& table) {
 	switch (input) {
 	case 's':
 		if (game.currentState == GS_INTRO) {
@@ -149,6 +211,7 @@ int HandleInput(Game& game, Player& player, AlienSwarm& aliens, Shield shields[]
 		}
 		break;
 	case 'q':
+	case PROFILER_TOGGLE_KEY:
 		return input;
 	case KEY_LEFT:
 		if (game.currentState == GS_PLAY) {
@@ -212,7 +275,7 @@ int HandleInput(Game& game, Player& player, AlienSwarm& aliens, Shield shields[]
 		else if (game.currentState == GS_HIGH_SCORES) {
 			game.currentState = GS_INTRO;
 			game.waitTimer = 0;
-			ResetGame(game, player, aliens, shields, numberOfShields);
+			ResetGame(game, player, aliens, shields);
 		}
 		else if (game.currentState == GS_INTRO) {
 			game.currentState = GS_PLAY;
@@ -223,7 +286,7 @@ int HandleInput(Game& game, Player& player, AlienSwarm& aliens, Shield shields[]
 	return ' ';
 }
 
-void UpdateGame(clock_t dt, Game& game, Player& player, Shield shields[], int numberOfShield, AlienSwarm& aliens, AlienUFO& ufo) {
+void UpdateGame(clock_t dt, Game& game, Player& player, ShieldArena& shields, AlienSwarm& aliens, AlienUFO& ufo) {
 	game.gameTimer += dt;
 
 	if (game.currentState == GS_PLAY) {
@@ -231,7 +294,7 @@ void UpdateGame(clock_t dt, Game& game, Player& player, Shield shields[], int nu
 
 		Position shieldCollisionPoint;
 
-		int shieldIndex = IsCollision(player.missile, shields, numberOfShield, shieldCollisionPoint);
+		int shieldIndex = IsCollision(game, player.missile, shields, shieldCollisionPoint);
 
 		if (shieldIndex != NOT_IN_PLAY) {
 			ResetMissile(player);
@@ -244,7 +307,7 @@ void UpdateGame(clock_t dt, Game& game, Player& player, Shield shields[], int nu
 			ResetMissile(player);
 			player.score += ResolveAlienCollison(aliens, AlienCollisionPoint);
 		}
-		if (UpdateAliens(game, aliens, player, shields, numberOfShield)) {
+		if (UpdateAliens(game, aliens, player, shields)) {
 			game.currentState = GS_PLAYER_DEAD;
 		}
 
@@ -253,7 +316,7 @@ void UpdateGame(clock_t dt, Game& game, Player& player, Shield shields[], int nu
 	
 			game.currentState = GS_WAIT;
 			game.waitTimer = WAIT_TIME;
-			ResetGame(game, player, aliens, shields, numberOfShield);
+			ResetGame(game, player, aliens, shields);
 		}
 
 		if (ufo.position.x == NOT_IN_PLAY) {
@@ -287,52 +350,143 @@ void UpdateGame(clock_t dt, Game& game, Player& player, Shield shields[], int nu
 	}
 }
 void FindEmptyRowAndColumns(const AlienSwarm& aliens, int& emptyColLeft, int& emptyColRight, int& emptyRowsBottom) {
-	bool found = false;
-	 
-	for (int col = 0; col < NUM_ALIEN_COLUMNS && !found; col++) {
-		for (int row = 0; row < NUM_ALIEN_ROWS && !found; row++) {
-			if (aliens.aliens[row][col] == AS_DEAD) {
-				if (row == NUM_ALIEN_ROWS - 1) {
-					emptyColLeft++;
-				}
-			}
-			else {
-				found = true;
+	// exploding aliens still hold their column and row until they are dead
+	if (aliens.lastColumn == NOT_IN_PLAY) {
+		emptyColLeft = aliens.numColumns;
+		emptyColRight = aliens.numColumns;
+		emptyRowsBottom = aliens.numRows;
+		return;
+	}
+
+	emptyColLeft = aliens.firstColumn;
+	emptyColRight = aliens.numColumns - 1 - aliens.lastColumn;
+	emptyRowsBottom = aliens.numRows - 1 - aliens.lastRow;
+}
+
+//the explosions are over: the aliens in them leave their column and row for good
+void ClearExplodedAliens(AlienSwarm& aliens) {
+	for (int row = 0; row < aliens.numRows; row++) {
+		for (int word = 0; word < aliens.rowWords; word++) {
+			for (unsigned long long bits = aliens.explodingRows[row * aliens.rowWords + word]; bits != 0; bits &= bits - 1) {
+				aliens.aliensInColumn[word * MASK_BITS + LowestBit(bits)]--;
+				aliens.aliensInRow[row]--;
 			}
 		}
 	}
 
-	found = false;
-	for (int col = NUM_ALIEN_COLUMNS - 1; col >= 0 && !found; col--) {
-		for (int row = 0; row < NUM_ALIEN_ROWS && !found; row++) {
-			if (aliens.aliens[row][col] == AS_DEAD) {
-				if (row == NUM_ALIEN_ROWS - 1) {
-					emptyColRight++;
-				}
-			}
-			else {
-				found = true;
-			}
+	fill(aliens.explodingRows.begin(), aliens.explodingRows.end(), 0ULL);
+	aliens.numAliensExploding = 0;
+
+	// the swarm only ever shrinks, so the bounds just move in past whatever edges emptied
+	while (aliens.lastColumn >= 0 && aliens.aliensInColumn[aliens.lastColumn] == 0) {
+		aliens.lastColumn--;
+	}
+	while (aliens.firstColumn < aliens.lastColumn && aliens.aliensInColumn[aliens.firstColumn] == 0) {
+		aliens.firstColumn++;
+	}
+	while (aliens.lastRow >= 0 && aliens.aliensInRow[aliens.lastRow] == 0) {
+		aliens.lastRow--;
+	}
+}
+
+AlienState GetAlienState(const AlienSwarm& aliens, int row, int col) {
+	if (IsBitSet(&aliens.aliveRows[row * aliens.rowWords], col)) {
+		return AS_ALIVE;
+	}
+	else if (IsBitSet(&aliens.explodingRows[row * aliens.rowWords], col)) {
+		return AS_EXPLODING;
+	}
+	return AS_DEAD;
+}
+
+int LowestBit(unsigned long long word) {
+#ifdef _MSC_VER
+	// a half at a time, _BitScanForward64 is only there on 64 bit targets
+	unsigned long index;
+	if (_BitScanForward(&index, (unsigned long)word)) {
+		return int(index);
+	}
+	_BitScanForward(&index, (unsigned long)(word >> 32));
+	return int(index) + 32;
+#else
+	return __builtin_ctzll(word);
+#endif
+}
+
+int HighestBit(unsigned long long word) {
+#ifdef _MSC_VER
+	unsigned long index;
+	if (_BitScanReverse(&index, (unsigned long)(word >> 32))) {
+		return int(index) + 32;
+	}
+	_BitScanReverse(&index, (unsigned long)word);
+	return int(index);
+#else
+	return 63 - __builtin_clzll(word);
+#endif
+}
+
+int GetMaskWords(int numberOfBits) {
+	return (numberOfBits + MASK_BITS - 1) / MASK_BITS;
+}
+
+void FillMask(unsigned long long mask[], int numberOfBits) {
+	for (int word = 0; word < GetMaskWords(numberOfBits); word++) {
+		int bitsInWord = min(int(MASK_BITS), numberOfBits - word * MASK_BITS);
+		mask[word] = (bitsInWord == MASK_BITS) ? ~0ULL : (1ULL << bitsInWord) - 1;
+	}
+}
+
+bool IsBitSet(const unsigned long long mask[], int bit) {
+	return (mask[bit / MASK_BITS] >> (bit % MASK_BITS)) & 1;
+}
+
+void ClearBit(unsigned long long mask[], int bit) {
+	mask[bit / MASK_BITS] &= ~(1ULL << (bit % MASK_BITS));
+}
+
+bool IsMaskEmpty(const unsigned long long mask[], int numberOfWords) {
+	for (int word = 0; word < numberOfWords; word++) {
+		if (mask[word] != 0) {
+			return false;
 		}
 	}
+	return true;
+}
 
-	found = false;
-	for (int row = NUM_ALIEN_ROWS - 1; row >= 0 && !found; row--) {
-		for (int col = 0; col < NUM_ALIEN_COLUMNS && !found; col++) {
-			if (aliens.aliens[row][col] == AS_DEAD) {
-				if (col == NUM_ALIEN_COLUMNS - 1) {
-					emptyRowsBottom++;
-				}
-			}
-			else {
-				found = true;
+int HighestBit(const unsigned long long mask[], int numberOfWords) {
+	for (int word = numberOfWords - 1; word >= 0; word--) {
+		if (mask[word] != 0) {
+			return word * MASK_BITS + HighestBit(mask[word]);
+		}
+	}
+	return NOT_IN_PLAY;
+}
+
+int CountBits(const unsigned long long mask[], int numberOfWords) {
+	int count = 0;
+	for (int word = 0; word < numberOfWords; word++) {
+		for (unsigned long long bits = mask[word]; bits != 0; bits &= bits - 1) {
+			count++;
+		}
+	}
+	return count;
+}
+
+int NthBit(const unsigned long long mask[], int numberOfWords, int n) {
+	// index of the n-th (0 based) set bit counting from the lowest one
+	for (int word = 0; word < numberOfWords; word++) {
+		for (unsigned long long bits = mask[word]; bits != 0; bits &= bits - 1) {
+			if (n-- == 0) {
+				return word * MASK_BITS + LowestBit(bits);
 			}
 		}
 	}
+	return NOT_IN_PLAY;
 }
 
-bool UpdateAliens(Game& game, AlienSwarm& aliens, Player& player, Shield shields[], int numberOfShields) {
-	if (UpdateBombs(game, aliens, player, shields, numberOfShields)) {
+bool UpdateAliens(Game& game, AlienSwarm& aliens, Player& player, ShieldArena& shields) {
+	if (UpdateBombs(game, aliens, player, shields)) {
 		return true;
 	}
 
@@ -340,12 +494,8 @@ bool UpdateAliens(Game& game, AlienSwarm& aliens, Player& player, Shield shields
 		aliens.explosionTimer--; //if explosionTimer == 0 -> explosionTimer = NOT_IN_PLAY
 	}
 
-	for (int row = 0; row < NUM_ALIEN_ROWS; row++) {
-		for (int col = 0; col < NUM_ALIEN_COLUMNS; col++) {
-			if (aliens.aliens[row][col] == AS_EXPLODING && aliens.explosionTimer == NOT_IN_PLAY) {
-				aliens.aliens[row][col] = AS_DEAD;
-			}
-		}
+	if (aliens.explosionTimer == NOT_IN_PLAY && aliens.numAliensExploding > 0) {
+		ClearExplodedAliens(aliens);
 	}
 
 	aliens.movementTime--;
@@ -356,7 +506,7 @@ bool UpdateAliens(Game& game, AlienSwarm& aliens, Player& player, Shield shields
 
 	FindEmptyRowAndColumns(aliens, emptyColsLeft, emptyColsRight, emptyRowsBottom);
 
-	int numberOfColumns = NUM_ALIEN_COLUMNS - emptyColsLeft - emptyColsRight;
+	int numberOfColumns = aliens.numColumns - emptyColsLeft - emptyColsRight;
 	int leftAlienPosition = aliens.position.x + emptyColsLeft * (aliens.spriteSize.width + ALIEN_PADDING);
 	int rightAlienPosition = leftAlienPosition + numberOfColumns * aliens.spriteSize.width + (numberOfColumns - 1) * ALIEN_PADDING;
 
@@ -368,7 +518,7 @@ bool UpdateAliens(Game& game, AlienSwarm& aliens, Player& player, Shield shields
 		aliens.line--;
 		aliens.direction = -aliens.direction;
 		ResetMovementTime(aliens);
-		DestroyShields(aliens, shields, numberOfShields);
+		DestroyShields(game, aliens, shields);
 
 		if (aliens.line == 0) {
 			game.currentState = GS_GAME_OVER;
@@ -380,28 +530,19 @@ bool UpdateAliens(Game& game, AlienSwarm& aliens, Player& player, Shield shields
 		aliens.position.x += aliens.direction;
 		ResetMovementTime(aliens);
 		aliens.animation = aliens.animation == 0 ? 1 : 0;
-		DestroyShields(aliens, shields, numberOfShields);
+		DestroyShields(game, aliens, shields);
 	}
 	else {
-		int activeColumns[NUM_ALIEN_COLUMNS]; //columns that still exist - some alines are still alive in that column
-		int numActiveCol = 0;
-
-		for (int c = emptyColsLeft; c < numberOfColumns; ++c) {
-			for (int r = 0; r < NUM_ALIEN_ROWS; r++) {
-				if (aliens.aliens[r][c] == AS_ALIVE) {
-					activeColumns[numActiveCol] = c;
-					numActiveCol++;
-					break;
-				}
-			}
-		}
+		//columns that still exist - some alines are still alive in that column
+		int numActiveCol = CountBits(aliens.columnsWithAliens.data(), aliens.rowWords);
 
 		if (ShouldShootBomb(aliens)) {
 			if (numActiveCol > 0) {
-				int numberOfShots = ((rand() % 3) + 1) - aliens.numberOfBombsInPlay;
+				// a volley grows with the number of bombs the wave may have in the air
+				int numberOfShots = ((GetRandom() % 3) + 1) * int(aliens.bombs.size()) / MAX_NUMBER_OF_ALIEN_BOMBS - aliens.numberOfBombsInPlay;
 
 				for (int i = 0; i < numberOfShots; i++) {
-					int columnToShoot = rand() % numActiveCol;
+					int columnToShoot = NthBit(aliens.columnsWithAliens.data(), aliens.rowWords, GetRandom() % numActiveCol);
 
 					ShootBomb(aliens, columnToShoot);
 				}
@@ -412,7 +553,7 @@ bool UpdateAliens(Game& game, AlienSwarm& aliens, Player& player, Shield shields
 	return false;
 }
 
-void DrawGame(const Game& game, const Player& player, Shield shields[], int numberOfShields, const AlienSwarm& aliens, AlienUFO& ufo, const HighScoreTable& table) {
+void DrawGame(const Game& game, const Player& player, ShieldArena& shields, const AlienSwarm& aliens, AlienUFO& ufo, const HighScoreTable& table) {
 	if (game.currentState == GS_PLAY || game.currentState == GS_WAIT || game.currentState == GS_PLAYER_DEAD) {
 		if (game.currentState == GS_PLAY || game.currentState == GS_WAIT) {
 			DrawPlayer(player, PLAYER_SPRITE);
@@ -421,7 +562,7 @@ void DrawGame(const Game& game, const Player& player, Shield shields[], int numb
 			DrawPlayer(player, PLAYER_EXPLOSION_SPRITE);
 		}
 
-		DrawShields(shields, numberOfShields);
+		DrawShields(shields);
 		DrawAliens(aliens);
 		DrawUFO(ufo);
 	}
@@ -436,6 +577,11 @@ void DrawGame(const Game& game, const Player& player, Shield shields[], int numb
 	}
 }
 
+bool IsIdleScreen(const Game& game) {
+	// nothing moves on these screens until a key is pressed
+	return game.currentState == GS_INTRO || game.currentState == GS_HIGH_SCORES || game.currentState == GS_GAME_OVER;
+}
+
 void MovePlayer(const Game& game, Player& player, int dx) {
 	if (player.position.x + player.spriteSize.width + dx > game.windowSize.width) {
 		player.position.x = game.windowSize.width - player.spriteSize.width;
@@ -463,7 +609,7 @@ void DrawPlayer(const Player& player, const char* sprite[]) {
 		DrawCharacter(player.missile.x, player.missile.y, PLAYER_MISSILE_SPRITE);
 	}
 
-	mvprintw(0, 0, "Score: %i  Lives %i", player.score, player.live);
+	DrawFormattedString(0, 0, "Score: %i  Lives %i", player.score, player.live);
 }
 
 void UpdateMissile(Player& player) {
@@ -476,174 +622,232 @@ void UpdateMissile(Player& player) {
 	}
 }
 
-void InitShields(const Game& game, Shield shields[], int numberOfShields) {
+ShieldArena::ShieldArena(int numberOfShields) : shields(numberOfShields) {
+	size_t arenaSize = shields.size() * SHIELD_PIXELS;
 
-	for (int i = 0; i < numberOfShields; i++) {
-		Shield& shield = shields[i];
+	// pixels and the template each start on a cache line; new[] only promises alignment for char
+	allocation = new char[2 * arenaSize + 2 * CACHE_LINE_SIZE];
+	pixels = allocation + (CACHE_LINE_SIZE - reinterpret_cast<uintptr_t>(allocation) % CACHE_LINE_SIZE);
+	templatePixels = pixels + (arenaSize + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
 
+	for (size_t i = 0; i < shields.size(); i++) {
 		for (int row = 0; row < SHEILD_SPRITE_HEIGHT; row++) {
-			shield.sprite[row] = new char[SHEILD_SPRITE_WIDTH + 1];
+			int offset = int(i) * SHIELD_PIXELS + row * SHIELD_ROW_STRIDE;
+
+			memcpy(templatePixels + offset, SHIELD_SPRITE[row], SHIELD_ROW_STRIDE); // row and its '\0'
+			shields[i].sprite[row] = pixels + offset;
 		}
 	}
-
-	ResetShields(game, shields, numberOfShields);
+	memcpy(pixels, templatePixels, arenaSize);
 }
 
-void CleanUpShields(Shield shields[], int numberOfShields) {
-	for (int i = 0; i < numberOfShields; i++) {
-		Shield& shield = shields[i];
-		for (int row = 0; row < SHEILD_SPRITE_HEIGHT; row++) {
-			delete[] shield.sprite[row];
-		}
-	}
+ShieldArena::~ShieldArena() {
+	delete[] allocation;
 }
 
-void DrawShields(const Shield shields[], int numberOfShields) {
+void DrawShields(const ShieldArena& shields) {
 
-	for (int i = 0; i < numberOfShields; i++) {
-		const Shield& shield = shields[i];
+	for (size_t i = 0; i < shields.shields.size(); i++) {
+		const Shield& shield = shields.shields[i];
 
 		DrawSprite(shield.position.x, shield.position.y, (const char**)shield.sprite, SHEILD_SPRITE_HEIGHT);
 	}
 }
 
-int IsCollision(const Position& projectile, const Shield shields[], int numberOfShields, Position& shieldCollisionPoint) {
+int IsCollision(const Game& game, const Position& projectile, const ShieldArena& shields, Position& shieldCollisionPoint) {
 	shieldCollisionPoint.x = NOT_IN_PLAY;
 	shieldCollisionPoint.y = NOT_IN_PLAY;
 
-	if (projectile.y != NOT_IN_PLAY) {
-		for (int i = 0; i < numberOfShields; i++) {
-			const Shield& shield = shields[i];
+	int shieldIndex = GetShieldOwner(game, projectile.x, projectile.y);
 
-			if ((projectile.x >= shield.position.x && projectile.x < (shield.position.x + SHEILD_SPRITE_WIDTH))
-				&& (projectile.y >= shield.position.y && projectile.y < (shield.position.y + SHEILD_SPRITE_HEIGHT))
-				&& shield.sprite[projectile.y - shield.position.y][projectile.x - shield.position.x] != ' '){
+	if (shieldIndex != NOT_IN_PLAY) {
+		const Shield& shield = shields.shields[shieldIndex];
 
-				//We collided
-				shieldCollisionPoint.x = projectile.x - shield.position.x;
-				shieldCollisionPoint.y = projectile.y - shield.position.y;
-				return i;
-			}
+		if (shield.sprite[projectile.y - shield.position.y][projectile.x - shield.position.x] != ' ') {
+			//We collided
+			shieldCollisionPoint.x = projectile.x - shield.position.x;
+			shieldCollisionPoint.y = projectile.y - shield.position.y;
+			return shieldIndex;
 		}
 	}
 
 	return NOT_IN_PLAY;
 }
 
-void ResolveShieldCollision(Shield shields[], int shieldIndex, const Position& shieldCollisionPoint) {
-	shields[shieldIndex].sprite[shieldCollisionPoint.y][shieldCollisionPoint.x] = ' ';
+//which shield covers the cell, NOT_IN_PLAY for none or for a cell off the screen
+int GetShieldOwner(const Game& game, int x, int y) {
+	if (x < 0 || x >= game.windowSize.width || y < 0 || y >= game.windowSize.height) {
+		return NOT_IN_PLAY;
+	}
+
+	return game.shieldOwners[y * game.windowSize.width + x];
+}
+
+void ResolveShieldCollision(ShieldArena& shields, int shieldIndex, const Position& shieldCollisionPoint) {
+	shields.shields[shieldIndex].sprite[shieldCollisionPoint.y][shieldCollisionPoint.x] = ' ';
 }
 
 void InitAliens(const Game& game, AlienSwarm& aliens) {
-	for (int row = 0; row < NUM_ALIEN_ROWS; row++) {
-		for (int col = 0; col < NUM_ALIEN_COLUMNS; col++) {
-			aliens.aliens[row][col] = AS_ALIVE;
-		}
+	// storage is sized here, at the start of every level, for whatever wave the game asked for
+	aliens.numRows = game.wave.numAlienRows;
+	aliens.numColumns = game.wave.numAlienColumns;
+	aliens.rowWords = GetMaskWords(aliens.numColumns);
+	aliens.columnWords = GetMaskWords(aliens.numRows);
+
+	aliens.aliveRows.assign(aliens.numRows * aliens.rowWords, 0);
+	aliens.explodingRows.assign(aliens.numRows * aliens.rowWords, 0);
+	for (int row = 0; row < aliens.numRows; row++) {
+		FillMask(&aliens.aliveRows[row * aliens.rowWords], aliens.numColumns);
+	}
+
+	aliens.aliveColumns.assign(aliens.numColumns * aliens.columnWords, 0);
+	for (int col = 0; col < aliens.numColumns; col++) {
+		FillMask(&aliens.aliveColumns[col * aliens.columnWords], aliens.numRows);
 	}
 
+	aliens.columnsWithAliens.assign(aliens.rowWords, 0);
+	FillMask(aliens.columnsWithAliens.data(), aliens.numColumns);
+
+	aliens.aliensInColumn.assign(aliens.numColumns, aliens.numRows);
+	aliens.aliensInRow.assign(aliens.numRows, aliens.numColumns);
+	aliens.firstColumn = 0;
+	aliens.lastColumn = aliens.numColumns - 1;
+	aliens.lastRow = aliens.numRows - 1;
+	aliens.numAliensExploding = 0;
+
 	aliens.direction = -1; //left
-	aliens.numAliensLeft = NUM_ALIEN_ROWS * NUM_ALIEN_COLUMNS;
+	aliens.numAliensLeft = aliens.numRows * aliens.numColumns;
 	aliens.animation = 0;
 	aliens.spriteSize.width = ALIEN_SPRITE_WIDTH;
 	aliens.spriteSize.height = ALIEN_SPRITE_HEIGHT;
 	aliens.numberOfBombsInPlay = 0;
-	aliens.position.x = (game.windowSize.width - NUM_ALIEN_COLUMNS * (ALIEN_SPRITE_WIDTH + ALIEN_PADDING)) / 2;
-	aliens.position.y = game.windowSize.height - NUM_ALIEN_COLUMNS - NUM_ALIEN_ROWS * ALIEN_SPRITE_HEIGHT - NUM_ALIEN_ROWS - 1 - 3 + game.level;
+	aliens.position.x = (game.windowSize.width - aliens.numColumns * (ALIEN_SPRITE_WIDTH + ALIEN_PADDING)) / 2;
+	aliens.position.y = game.windowSize.height - aliens.numColumns - aliens.numRows * ALIEN_SPRITE_HEIGHT - aliens.numRows - 1 - 3 + game.level;
 	aliens.line = 7 - (game.level - 1);
 	aliens.explosionTimer = 0;
 
-	for (int i = 0; i < MAX_NUMBER_OF_ALIEN_BOMBS; i++) {
-		aliens.bombs[i].animation = 0;
-		aliens.bombs[i].position.x = NOT_IN_PLAY;
-		aliens.bombs[i].position.y = NOT_IN_PLAY;
-	}
+	InitSpriteStrip(aliens.rowSprites[ALIEN_SPRITE_30], ALIEN30_SPRITE, ALIEN_SPRITE_WIDTH, ALIEN_SPRITE_HEIGHT, ALIEN_ANIMATION_FRAMES, ALIEN_PADDING, aliens.numColumns);
+	InitSpriteStrip(aliens.rowSprites[ALIEN_SPRITE_20], ALIEN20_SPRITE, ALIEN_SPRITE_WIDTH, ALIEN_SPRITE_HEIGHT, ALIEN_ANIMATION_FRAMES, ALIEN_PADDING, aliens.numColumns);
+	InitSpriteStrip(aliens.rowSprites[ALIEN_SPRITE_10], ALIEN10_SPRITE, ALIEN_SPRITE_WIDTH, ALIEN_SPRITE_HEIGHT, ALIEN_ANIMATION_FRAMES, ALIEN_PADDING, aliens.numColumns);
+	InitSpriteStrip(aliens.rowSprites[ALIEN_SPRITE_EXPLOSION], ALIEN_EXPLOSION, ALIEN_SPRITE_WIDTH, ALIEN_SPRITE_HEIGHT, 1, ALIEN_PADDING, aliens.numColumns);
+
+	AlienBomb bomb;
+	bomb.animation = 0;
+	bomb.position.x = NOT_IN_PLAY;
+	bomb.position.y = NOT_IN_PLAY;
+	aliens.bombs.assign(game.wave.maxNumberOfBombs, bomb);
 }
 
 void DrawAliens(const AlienSwarm& aliens) {
-	//draw 1 row of the 30 point aliens
+	//1 row of the 30 point aliens, 2 rows of the 20 point aliens and the rest are 10 point aliens
 	const int NUM_30_POINT_ALIEN_ROWS = 1;
+	const int NUM_20_POINT_ALIEN_ROWS = 2;
 
-	for (int col = 0; col < NUM_ALIEN_COLUMNS; col++) {
-		int xPos = aliens.position.x + col * (aliens.spriteSize.width + ALIEN_PADDING);
-		int yPos = aliens.position.y;
-
-		if (aliens.aliens[0][col] == AS_ALIVE) {
-			DrawSprite(xPos, yPos, ALIEN30_SPRITE, aliens.spriteSize.height, aliens.animation*aliens.spriteSize.height);
+	for (int row = 0; row < aliens.numRows; row++) {
+		int sprite = ALIEN_SPRITE_10;
+		if (row < NUM_30_POINT_ALIEN_ROWS) {
+			sprite = ALIEN_SPRITE_30;
 		}
-		else if (aliens.aliens[0][col] == AS_EXPLODING) {
-			DrawSprite(xPos, yPos, ALIEN_EXPLOSION, aliens.spriteSize.height);
+		else if (row < NUM_30_POINT_ALIEN_ROWS + NUM_20_POINT_ALIEN_ROWS) {
+			sprite = ALIEN_SPRITE_20;
 		}
-	}
 
-	//draw 2 row of the 20 point aliens
-	const int NUM_20_POINT_ALIEN_ROWS = 2;
+		DrawAlienRow(aliens, aliens.aliveRows, row, aliens.rowSprites[sprite], aliens.animation);
+		DrawAlienRow(aliens, aliens.explodingRows, row, aliens.rowSprites[ALIEN_SPRITE_EXPLOSION], 0);
+	}
 
-	for (int row = 0; row < NUM_20_POINT_ALIEN_ROWS; row++) {
-		for (int col = 0; col < NUM_ALIEN_COLUMNS; col++) {
-			int xPos = aliens.position.x + col * (aliens.spriteSize.width + ALIEN_PADDING);
-			int yPos = aliens.position.y + row * (aliens.spriteSize.height + ALIEN_PADDING) + NUM_30_POINT_ALIEN_ROWS * (aliens.spriteSize.height + +ALIEN_PADDING);
-			
-			if (aliens.aliens[NUM_30_POINT_ALIEN_ROWS + row][col] == AS_ALIVE) {
-				DrawSprite(xPos, yPos, ALIEN20_SPRITE, aliens.spriteSize.height, aliens.animation * aliens.spriteSize.height);
-			}
-			else if (aliens.aliens[NUM_30_POINT_ALIEN_ROWS + row][col] == AS_EXPLODING) {
-				DrawSprite(xPos, yPos, ALIEN_EXPLOSION, aliens.spriteSize.height);
+	if (aliens.numberOfBombsInPlay > 0) {
+		for (size_t i = 0; i < aliens.bombs.size(); i++) {
+			if (aliens.bombs[i].position.x != NOT_IN_PLAY && aliens.bombs[i].position.y != NOT_IN_PLAY) {
+				DrawCharacter(aliens.bombs[i].position.x, aliens.bombs[i].position.y, ALIEN_BOMB_SPRITE[aliens.bombs[i].animation]);
 			}
 		}
 	}
+}
 
-	//draw 2 rows of the 10 point aliens
-	const int NUM_10_POINT_ALIEN_ROWS = 2;
-	for (int row = 0; row < NUM_10_POINT_ALIEN_ROWS; row++) {
-		for (int col = 0; col < NUM_ALIEN_COLUMNS; col++) {
-			int xPos = aliens.position.x + col * (aliens.spriteSize.width + ALIEN_PADDING);
-			int yPos = aliens.position.y + row * (aliens.spriteSize.height + ALIEN_PADDING) + NUM_30_POINT_ALIEN_ROWS * (aliens.spriteSize.height + +ALIEN_PADDING) + NUM_20_POINT_ALIEN_ROWS * (aliens.spriteSize.height + +ALIEN_PADDING);
+//draws the aliens whose bit is set in that row of rowMasks, each run of neighbours as one piece of the strip
+void DrawAlienRow(const AlienSwarm& aliens, const std::vector<unsigned long long>& rowMasks, int row, const SpriteStrip& strip, int frame) {
+	int yPos = aliens.position.y + row * (aliens.spriteSize.height + ALIEN_PADDING);
+	int runStart = 0;
+	int runEnd = 0; // one past the last column of the run so far
 
-			if (aliens.aliens[NUM_30_POINT_ALIEN_ROWS + NUM_20_POINT_ALIEN_ROWS + row][col] == AS_ALIVE) {
-				DrawSprite(xPos, yPos, ALIEN10_SPRITE, aliens.spriteSize.height, aliens.animation * aliens.spriteSize.height);
-			}
-			else if (aliens.aliens[NUM_30_POINT_ALIEN_ROWS + NUM_20_POINT_ALIEN_ROWS + row][col] == AS_EXPLODING) {
-				DrawSprite(xPos, yPos, ALIEN_EXPLOSION, aliens.spriteSize.height);
+	for (int word = 0; word < aliens.rowWords; word++) {
+		unsigned long long bits = rowMasks[row * aliens.rowWords + word];
+
+		while (bits != 0) {
+			int first = LowestBit(bits);
+			unsigned long long clearAbove = ~(bits >> first); // lowest set bit is where the run of set bits stops
+			int length = (clearAbove == 0) ? MASK_BITS - first : LowestBit(clearAbove);
+			int col = word * MASK_BITS + first;
+
+			if (col != runEnd) {
+				if (runEnd > runStart) {
+					DrawSpriteStrip(strip, aliens.position.x, yPos, frame, runStart, runEnd - runStart);
+				}
+				runStart = col;
 			}
+			runEnd = col + length; // a run carries on into the next word when it reaches the top bit
+
+			bits = (first + length == MASK_BITS) ? 0 : bits & (~0ULL << (first + length));
 		}
 	}
 
-	if (aliens.numberOfBombsInPlay > 0) {
-		for (int i = 0; i < MAX_NUMBER_OF_ALIEN_BOMBS; i++) {
-			if (aliens.bombs[i].position.x != NOT_IN_PLAY && aliens.bombs[i].position.y != NOT_IN_PLAY) {
-				DrawCharacter(aliens.bombs[i].position.x, aliens.bombs[i].position.y, ALIEN_BOMB_SPRITE[aliens.bombs[i].animation]);
-			}
-		}
+	if (runEnd > runStart) {
+		DrawSpriteStrip(strip, aliens.position.x, yPos, frame, runStart, runEnd - runStart);
 	}
 }
 
 //Alien collision
 bool IsColission(const Player& player, const AlienSwarm& aliens, Position& alienCollisionPositionInArray) {
-	alienCollisionPositionInArray.x = NOT_IN_PLAY;
-	alienCollisionPositionInArray.y = NOT_IN_PLAY;
-
-	for (int row = 0; row < NUM_ALIEN_ROWS; row++) {
-		for (int col = 0; col < NUM_ALIEN_COLUMNS; col++) {
-			int xPos = aliens.position.x + col * (aliens.spriteSize.width + ALIEN_PADDING);
-			int yPos = aliens.position.y + row * (aliens.spriteSize.height + ALIEN_PADDING);
-
-			if (aliens.aliens[row][col] == AS_ALIVE &&
-				player.missile.x >= xPos && player.missile.x < xPos + aliens.spriteSize.width &&
-				player.missile.y >= yPos && player.missile.y < yPos + aliens.spriteSize.height)
-			{
-				alienCollisionPositionInArray.x = col;
-				alienCollisionPositionInArray.y = row;
-				return true;
-			}
-		}
+	return FindAlienAt(aliens, player.missile, alienCollisionPositionInArray);
+}
+
+//The swarm is a regular grid, so the cell under a position is worked out instead of searched for
+bool FindAlienAt(const AlienSwarm& aliens, const Position& position, Position& alienPositionInArray) {
+	alienPositionInArray.x = NOT_IN_PLAY;
+	alienPositionInArray.y = NOT_IN_PLAY;
+
+	int cellWidth = aliens.spriteSize.width + ALIEN_PADDING;
+	int cellHeight = aliens.spriteSize.height + ALIEN_PADDING;
+	int dx = position.x - aliens.position.x;
+	int dy = position.y - aliens.position.y;
+
+	if (position.y == NOT_IN_PLAY || dx < 0 || dy < 0) {
+		return false;
 	}
-	return false;
+
+	int col = dx / cellWidth;
+	int row = dy / cellHeight;
+
+	// past the swarm, or in the padding between two aliens
+	if (col >= aliens.numColumns || row >= aliens.numRows || dx % cellWidth >= aliens.spriteSize.width || dy % cellHeight >= aliens.spriteSize.height) {
+		return false;
+	}
+
+	if (!IsBitSet(&aliens.aliveRows[row * aliens.rowWords], col)) {
+		return false;
+	}
+
+	alienPositionInArray.x = col;
+	alienPositionInArray.y = row;
+	return true;
 }
 
 int ResolveAlienCollison(AlienSwarm& aliens, const Position& hitPositionInAliensArray) {
-	aliens.aliens[hitPositionInAliensArray.y][hitPositionInAliensArray.x] = AS_EXPLODING;
+	int row = hitPositionInAliensArray.y;
+	int col = hitPositionInAliensArray.x;
+	unsigned long long* columnMask = &aliens.aliveColumns[col * aliens.columnWords];
+
+	ClearBit(&aliens.aliveRows[row * aliens.rowWords], col);
+	ClearBit(columnMask, row);
+	aliens.explodingRows[row * aliens.rowWords + col / MASK_BITS] |= 1ULL << (col % MASK_BITS);
+	aliens.numAliensExploding++;
 	aliens.numAliensLeft--;
 
+	if (IsMaskEmpty(columnMask, aliens.columnWords)) {
+		ClearBit(aliens.columnsWithAliens.data(), col);
+	}
+
 	if (aliens.explosionTimer == NOT_IN_PLAY) {
 		aliens.explosionTimer = ALIEN_EXPLOSION_TIME;
 	}
@@ -660,87 +864,81 @@ int ResolveAlienCollison(AlienSwarm& aliens, const Position& hitPositionInAliens
 }
 
 void ResetMovementTime(AlienSwarm& aliens) {
-	aliens.movementTime =  aliens.line * 2 + (5 * (float(aliens.numAliensLeft) / float(NUM_ALIEN_COLUMNS * NUM_ALIEN_ROWS)));
+	aliens.movementTime =  aliens.line * 2 + (5 * (float(aliens.numAliensLeft) / float(aliens.numColumns * aliens.numRows)));
 }
 
-void DestroyShields(const AlienSwarm& aliens, Shield shields[], int numberOfShields) {
-	for (int row = 0; row < NUM_ALIEN_ROWS; row++) {
-		for (int col = 0; col < NUM_ALIEN_COLUMNS; col++) {
-			if (aliens.aliens[row][col] == AS_ALIVE) {
+void DestroyShields(const Game& game, const AlienSwarm& aliens, ShieldArena& shields) {
+	for (int row = 0; row < aliens.numRows; row++) {
+		for (int word = 0; word < aliens.rowWords; word++) {
+			for (unsigned long long alive = aliens.aliveRows[row * aliens.rowWords + word]; alive != 0; alive &= alive - 1) {
+				int col = word * MASK_BITS + LowestBit(alive);
 				int xPos = aliens.position.x + col * (aliens.spriteSize.width + ALIEN_PADDING);
 				int yPos = aliens.position.y + row * (aliens.spriteSize.height + ALIEN_PADDING);
 
-				CollideShieldsWithAlien(shields, numberOfShields, xPos, yPos, aliens.spriteSize);
+				CollideShieldsWithAlien(game, shields, xPos, yPos, aliens.spriteSize);
 			}
 		}
 	}
 }
 
-void CollideShieldsWithAlien(Shield shields[], int numberOfShields, int alienPosX, int alienPosY, const Size& size) {
-	for (int s = 0; s < numberOfShields; s++) {
-		Shield& shield = shields[s];
+//Wipes out whatever shield is under the alien, one owner map lookup per cell it covers
+void CollideShieldsWithAlien(const Game& game, ShieldArena& shields, int alienPosX, int alienPosY, const Size& size) {
+	for (int y = alienPosY; y < alienPosY + size.height; y++) {
+		for (int x = alienPosX; x < alienPosX + size.width; x++) {
+			int shieldIndex = GetShieldOwner(game, x, y);
 
-		if (alienPosX < shield.position.x + SHEILD_SPRITE_WIDTH && alienPosX + size.width >= shield.position.x &&
-				alienPosY < shield.position.y + SHEILD_SPRITE_HEIGHT && alienPosY + size.height >= shield.position.y) {
-			// We colliding
-			int dy = alienPosY - shield.position.y;
-			int dx = alienPosX - shield.position.x;
-
-			for (int h = 0; h < size.height; h++) {
-				int shieldY = dy + h;
-				if (shieldY >= 0 && shieldY < SHEILD_SPRITE_HEIGHT) {
-					for (int w = 0; w < size.width; w++) {
-						int shieldX = dx + w;
-						if (shieldX >= 0 && shieldX < SHEILD_SPRITE_WIDTH) {
-							shield.sprite[shieldY][shieldX] = ' ';
-						}
-					}
-				}
+			if (shieldIndex != NOT_IN_PLAY) {
+				// We colliding
+				Shield& shield = shields.shields[shieldIndex];
+				shield.sprite[y - shield.position.y][x - shield.position.x] = ' ';
 			}
-			break;
 		}
 	}
 }
 
 bool ShouldShootBomb(const AlienSwarm& aliens) {
-	return int(rand() % (70 - int(float(NUM_ALIEN_ROWS * NUM_ALIEN_COLUMNS) / float(aliens.numAliensLeft + 1)))) < 3;
+	// the odds go up as the swarm thins out, a huge swarm with few left fires every frame
+	return int(GetRandom() % max(1, 70 - int(float(aliens.numRows * aliens.numColumns) / float(aliens.numAliensLeft + 1)))) < 3;
 }
 
 void ShootBomb(AlienSwarm& aliens, int columnToShoot) {
 	int bombId = NOT_IN_PLAY;
 
-	for (int i = 0; i < MAX_NUMBER_OF_ALIEN_BOMBS; i++) {
+	for (int i = 0; i < int(aliens.bombs.size()); i++) {
 		if (aliens.bombs[i].position.x == NOT_IN_PLAY || aliens.bombs[i].position.y == NOT_IN_PLAY) {
 			bombId = i;
 			break;
 		}
 	}
 
-	for (int r = NUM_ALIEN_ROWS- 1; r >= 0; r--) {
-		if (aliens.aliens[r][columnToShoot] == AS_ALIVE) {
-			int xPos = aliens.position.x + columnToShoot * (aliens.spriteSize.width + ALIEN_PADDING) + 1;
-			int yPos = aliens.position.y + r * (aliens.spriteSize.height + ALIEN_PADDING) + aliens.spriteSize.height;
+	if (bombId == NOT_IN_PLAY) {
+		return; // every bomb is already in play
+	}
 
-			aliens.bombs[bombId].animation = 0;
-			aliens.bombs[bombId].position.x = xPos;
-			aliens.bombs[bombId].position.y = yPos;
-			aliens.numberOfBombsInPlay++;
-			break;
-		}
+	const unsigned long long* columnMask = &aliens.aliveColumns[columnToShoot * aliens.columnWords];
 
+	if (!IsMaskEmpty(columnMask, aliens.columnWords)) {
+		int r = HighestBit(columnMask, aliens.columnWords); // the bomb drops from the lowest alien
+		int xPos = aliens.position.x + columnToShoot * (aliens.spriteSize.width + ALIEN_PADDING) + 1;
+		int yPos = aliens.position.y + r * (aliens.spriteSize.height + ALIEN_PADDING) + aliens.spriteSize.height;
+
+		aliens.bombs[bombId].animation = 0;
+		aliens.bombs[bombId].position.x = xPos;
+		aliens.bombs[bombId].position.y = yPos;
+		aliens.numberOfBombsInPlay++;
 	}
 }
 
-bool UpdateBombs(const Game& game, AlienSwarm& aliens, Player& player, Shield shields[], int numberOfShields) {
+bool UpdateBombs(const Game& game, AlienSwarm& aliens, Player& player, ShieldArena& shields) {
 	int numBombSprites = strlen(ALIEN_BOMB_SPRITE);
 
-	for (int i = 0; i < MAX_NUMBER_OF_ALIEN_BOMBS; i++) {
+	for (size_t i = 0; i < aliens.bombs.size(); i++) {
 		if (aliens.bombs[i].position.x != NOT_IN_PLAY || aliens.bombs[i].position.y != NOT_IN_PLAY) {
 			aliens.bombs[i].position.y += ALIEN_BOMB_SPEED;
 			aliens.bombs[i].animation = (aliens.bombs[i].animation + 1) % numBombSprites;
 
 			Position collisionPoint;
-			int shieldIndex = IsCollision(aliens.bombs[i].position, shields, numberOfShields, collisionPoint);
+			int shieldIndex = IsCollision(game, aliens.bombs[i].position, shields, collisionPoint);
 
 			if (shieldIndex != NOT_IN_PLAY) {
 				aliens.bombs[i].position.x = NOT_IN_PLAY;
@@ -756,7 +954,7 @@ bool UpdateBombs(const Game& game, AlienSwarm& aliens, Player& player, Shield sh
 				aliens.numberOfBombsInPlay--;
 				return true;
 			}
-			else if (aliens.bombs->position.y >= game.windowSize.height) {
+			else if (aliens.bombs[i].position.y >= game.windowSize.height) {
 				aliens.bombs[i].position.x = NOT_IN_PLAY;
 				aliens.bombs[i].position.y = NOT_IN_PLAY;
 				aliens.bombs[i].animation = 0;
@@ -772,24 +970,37 @@ bool IsColission(const Position& projectile, const Position& spritePosition, con
 		(projectile.y >= spritePosition.y && projectile.y < (spritePosition.y + spriteSize.height));
 }
 
-void ResetGame(Game& game, Player& player, AlienSwarm& aliens, Shield shields[], int numberOfShield) {
+void ResetGame(Game& game, Player& player, AlienSwarm& aliens, ShieldArena& shields) {
 	game.gameTimer = 0;
 	ResetPlayer(game, player);
-	ResetShields(game, shields, numberOfShield);
+	ResetShields(game, shields);
 	InitAliens(game, aliens);
 }
 
-void ResetShields(const Game& game, Shield shields[], int numberOfShields) {
+void ResetShields(Game& game, ShieldArena& shields) {
+	int numberOfShields = int(shields.shields.size());
 	int firstPadding = ceil(float(game.windowSize.width - numberOfShields * SHEILD_SPRITE_WIDTH) / float(numberOfShields + 1));
 	int xPadding = floor(float(game.windowSize.width - numberOfShields * SHEILD_SPRITE_WIDTH) / float(numberOfShields + 1));
 
+	game.shieldOwners.assign(game.windowSize.width * game.windowSize.height, NOT_IN_PLAY);
+
+	// every shield back to new in one go
+	memcpy(shields.pixels, shields.templatePixels, shields.shields.size() * SHIELD_PIXELS);
+
 	for (int i = 0; i < numberOfShields; i++) {
-		Shield& shield = shields[i];
+		Shield& shield = shields.shields[i];
 		shield.position.x = firstPadding + i * (SHEILD_SPRITE_WIDTH + xPadding);
 		shield.position.y = game.windowSize.height - PLAYER_SPRITE_HEIGHT - SHEILD_SPRITE_HEIGHT - 3;
 
 		for (int row = 0; row < SHEILD_SPRITE_HEIGHT; row++) {
-			strcpy_s(shield.sprite[row], SHEILD_SPRITE_WIDTH + 1, SHIELD_SPRITE[row]);
+			for (int col = 0; col < SHEILD_SPRITE_WIDTH; col++) {
+				int x = shield.position.x + col;
+				int y = shield.position.y + row;
+
+				if (x >= 0 && x < game.windowSize.width && y >= 0 && y < game.windowSize.height) {
+					game.shieldOwners[y * game.windowSize.width + x] = static_cast<short>(i);
+				}
+			}
 		}
 	}
 }
@@ -811,13 +1022,13 @@ void DrawGameOverScreen(const Game& game) {
 
 	for (int i = 0; i < MAX_LENGHT_OF_NAME; i++) {
 		if (i == game.gameOverHPositionCursor) {
-			attron(A_UNDERLINE);
+			AttributeOn(A_UNDERLINE);
 		}
 
 		DrawCharacter(game.windowSize.width / 2 - MAX_LENGHT_OF_NAME / 2 + i, yPos + 5, game.playerName[i]);
 
 		if (i == game.gameOverHPositionCursor) {
-			attroff(A_UNDERLINE);
+			AttributeOff(A_UNDERLINE);
 		}
 	}
 }
@@ -842,7 +1053,7 @@ void ResetUFO(AlienUFO& ufo) {
 	ufo.size.width = UFO_SPRITE_WIDTH;
 	ufo.size.height = UFO_SPRITE_HEIGHT;
 
-	ufo.points = ((rand() % 4) + 1) * 50;
+	ufo.points = ((GetRandom() % 4) + 1) * 50;
 
 	ufo.position.x = NOT_IN_PLAY; // No ufo on the screen
 	ufo.position.y = ufo.size.height;
@@ -873,74 +1084,222 @@ void ResetGameOverPositionCursor(Game& game) {
 	}
 }
 
-void AddHighScore(HighScoreTable& table, int score, const std::string& name) {
-	Score highScore;
-	highScore.score = score;
-	highScore.name = name;
-
-	table.scores.push_back(highScore);
-
-	sort(table.scores.begin(), table.scores.end(), ScoreCompare);
-
-	SaveHighScore(table);
-}
-
-bool ScoreCompare(const Score& score1, const Score& score2) {
-	return score1.score > score2.score;
-}
-
 void DrawHighScoreTable(const Game& game, const HighScoreTable& table) {
 	const char* title = "High Scores";
 	int titleXPos = game.windowSize.width / 2 - strlen(title) / 2;
 	int yPos = 5;
 	int yPadding = 2;
 
-	attron(A_UNDERLINE);
+	AttributeOn(A_UNDERLINE);
 	DrawString(titleXPos, yPos, title);
-	attroff(A_UNDERLINE);
+	AttributeOff(A_UNDERLINE);
 
-	for (int i = 0; i < table.scores.size() && i < MAX_HIGH_SCORES; i++) {
+	for (int i = 0; i < int(table.scores.size()) && i < MAX_HIGH_SCORES; i++) {
 		Score score = table.scores[i];
 
-		mvprintw(yPos + (i + 1) * yPadding, titleXPos - MAX_LENGHT_OF_NAME, "%s\t\t%i", score.name.c_str(), score.score);
+		DrawFormattedString(titleXPos - MAX_LENGHT_OF_NAME, yPos + (i + 1) * yPadding, "%s\t\t%i", score.name.c_str(), score.score);
+	}
+}
+
+unsigned int randomState = 1;
+
+void SeedRandom(unsigned int seed) {
+	randomState = (seed == 0) ? 1 : seed; // xorshift gets stuck on a zero state
+}
+
+int GetRandom() {
+	// xorshift32: cheap, and the same seed gives the same game on every platform
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 17;
+	randomState ^= randomState << 5;
+	return int(randomState & 0x7FFFFFFF);
+}
+
+int GetAutopilotInput(const Game& game) {
+	if (game.currentState == GS_PLAYER_DEAD) {
+		return ' ';
+	}
+
+	switch (GetRandom() % 4) {
+	case 0:
+		return KEY_LEFT;
+	case 1:
+		return KEY_RIGHT;
+	case 2:
+		return ' ';
+	default:
+		return ERR; // no key pressed this frame
 	}
 }
 
-void SaveHighScore(const HighScoreTable& table) {
-	ofstream outFile;
-	outFile.open(filename);
+void InitWaveConfig(WaveConfig& wave) {
+	wave.numAlienRows = NUM_ALIEN_ROWS;
+	wave.numAlienColumns = NUM_ALIEN_COLUMNS;
+	wave.maxNumberOfBombs = MAX_NUMBER_OF_ALIEN_BOMBS;
+	wave.numShields = NUM_SHIELDS;
+}
+
+// Runs the game with the autopilot and no terminal. A stress test also draws every frame
+// into the screen buffer and reports where the frame time went.
+int RunHeadless(long long numberOfFrames, unsigned int seed, const WaveConfig& wave, bool isStressTest) {
+	SeedRandom(seed);
+
+	// a bigger swarm gets a window grown by as much as the swarm, so it moves the way a normal one does
+	int extraColumns = max(0, wave.numAlienColumns - NUM_ALIEN_COLUMNS);
+	int extraRows = max(0, wave.numAlienRows - NUM_ALIEN_ROWS);
+	Size windowSize;
+	windowSize.width = HEADLESS_WINDOW_WIDTH + extraColumns * (ALIEN_SPRITE_WIDTH + ALIEN_PADDING);
+	windowSize.height = HEADLESS_WINDOW_HEIGHT + extraColumns + extraRows * (ALIEN_SPRITE_HEIGHT + ALIEN_PADDING);
+
+	Game game;
+	Player player;
+	AlienSwarm aliens;
+	AlienUFO ufo;
+	HighScoreTable table;
+
+	InitGame(game, windowSize);
+	InitHighScoreTable(table, MAX_HIGH_SCORES, false, NULL, NULL);
+	game.wave = wave;
+	game.wave.numShields = NUM_SHIELDS * windowSize.width / HEADLESS_WINDOW_WIDTH;
+	game.level = 1;
+	ShieldArena shields(game.wave.numShields);
+	InitPlayer(game, player);
+	ResetShields(game, shields);
+	InitAliens(game, aliens);
+	ResetUFO(ufo);
+	game.currentState = GS_PLAY;
+
+	long long gamesPlayed = 0;
+	long long totalScore = 0;
+	unsigned long long checksum = 14695981039346656037ULL;
+	long long updateTime = 0;
+	long long drawTime = 0;
+	long long aliensSeen = 0;
+	long long bombsSeen = 0;
+
+	chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+	for (long long frame = 0; frame < numberOfFrames; frame++) {
+		long long frameStart = isStressTest ? GetTimeMicroseconds() : 0;
+
+		ProcessInput(GetAutopilotInput(game), game, player, aliens, shields, table);
+		UpdateGame(FIXED_TIMESTEP, game, player, shields, aliens, ufo);
 
-	if (outFile.is_open()) {
-		for (int i = 0; i < table.scores.size() && i < MAX_HIGH_SCORES; i++) {
-			outFile << table.scores[i].name << " " << table.scores[i].score << endl;
+		if (isStressTest) {
+			long long updateEnd = GetTimeMicroseconds();
+
+			ClearScreen(game.windowSize.width, game.windowSize.height);
+			DrawGame(game, player, shields, aliens, ufo, table);
+
+			updateTime += updateEnd - frameStart;
+			drawTime += GetTimeMicroseconds() - updateEnd;
+			aliensSeen += aliens.numAliensLeft;
+			bombsSeen += aliens.numberOfBombsInPlay;
 		}
+
+		checksum = UpdateChecksum(checksum, game, player, aliens);
+
+		if (game.currentState == GS_GAME_OVER) {
+			gamesPlayed++;
+			totalScore += player.score;
+
+			game.level = 1;
+			InitPlayer(game, player);
+			ResetGame(game, player, aliens, shields);
+			ResetUFO(ufo);
+			game.currentState = GS_PLAY;
+		}
+	}
+
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - startTime;
+
+	if (isStressTest) {
+		cout << "swarm:         " << wave.numAlienRows << " x " << wave.numAlienColumns << " aliens, " << wave.maxNumberOfBombs << " bombs" << endl;
+		cout << "window:        " << windowSize.width << " x " << windowSize.height << ", " << shields.shields.size() << " shields" << endl;
 	}
+	cout << "frames:        " << numberOfFrames << endl;
+	cout << "seed:          " << seed << endl;
+	cout << "games played:  " << gamesPlayed << endl;
+	cout << "total score:   " << totalScore + player.score << endl;
+	cout << "checksum:      " << hex << checksum << dec << endl;
+	cout << "elapsed:       " << elapsed.count() << " s" << endl;
+	if (elapsed.count() > 0.0 && numberOfFrames > 0) {
+		cout << "frames/sec:    " << numberOfFrames / elapsed.count() << endl;
+		cout << "ns/frame:      " << elapsed.count() * 1e9 / numberOfFrames << endl;
+	}
+	if (isStressTest && numberOfFrames > 0) {
+		cout << "avg aliens:    " << double(aliensSeen) / numberOfFrames << endl;
+		cout << "avg bombs:     " << double(bombsSeen) / numberOfFrames << endl;
+		cout << "update us/frame: " << double(updateTime) / numberOfFrames << endl;
+		cout << "draw us/frame:   " << double(drawTime) / numberOfFrames << endl;
+	}
+
+	return 0;
 }
 
-void LoadHighScore(HighScoreTable& table) {
-	ifstream inFile;
+// Plays a journal written by --record back through the same updates, with no terminal and no waiting
+int RunReplay(const char* journalFile) {
+	InputJournal journal;
 
-	inFile.open(filename);
+	if (!LoadInputJournal(journal, journalFile)) {
+		cout << "Could not read the journal " << journalFile << endl;
+		return 1;
+	}
 
-	string name;
-	int scoreVal;
+	SeedRandom(journal.seed);
 
-	Score score;
+	Game game;
+	Player player;
+	AlienSwarm aliens;
+	AlienUFO ufo;
+	HighScoreTable table;
 
-	if (inFile.is_open()) {
-		while (!inFile.eof()) {
-			inFile >> ws;
-			if (inFile.eof()) {
-				break;
-			}
+	InitGame(game, journal.windowSize);
+	InitHighScoreTable(table, MAX_HIGH_SCORES, false, NULL, NULL);
+	game.level = 1;
+	ShieldArena shields(game.wave.numShields);
+	InitPlayer(game, player);
+	ResetShields(game, shields);
+	InitAliens(game, aliens);
+	ResetUFO(ufo);
+
+	unsigned long long checksum = 14695981039346656037ULL;
 
-			inFile >> name >> scoreVal;
-			score.name = name;
-			score.score = scoreVal;
+	chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
 
-			table.scores.push_back(score);
+	for (unsigned int frame = 0; frame < journal.numberOfFrames; frame++) {
+		for (int input = NextReplayInput(journal, frame); input != JOURNAL_NO_INPUT; input = NextReplayInput(journal, frame)) {
+			ProcessInput(input, game, player, aliens, shields, table);
 		}
+		UpdateGame(FIXED_TIMESTEP, game, player, shields, aliens, ufo);
 
-		inFile.close();
+		checksum = UpdateChecksum(checksum, game, player, aliens);
 	}
-}
\ No newline at end of file
+
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - startTime;
+
+	cout << "journal:       " << journalFile << endl;
+	cout << "window:        " << journal.windowSize.width << " x " << journal.windowSize.height << endl;
+	cout << "seed:          " << journal.seed << endl;
+	cout << "frames:        " << journal.numberOfFrames << " (" << double(journal.numberOfFrames) / FPS << " s of play)" << endl;
+	cout << "keys:          " << journal.entries.size() << endl;
+	cout << "score:         " << player.score << endl;
+	cout << "level:         " << game.level << endl;
+	cout << "checksum:      " << hex << checksum << dec << endl;
+	cout << "elapsed:       " << elapsed.count() << " s" << endl;
+	if (elapsed.count() > 0.0 && journal.numberOfFrames > 0) {
+		cout << "frames/sec:    " << journal.numberOfFrames / elapsed.count() << endl;
+		cout << "ns/frame:      " << elapsed.count() * 1e9 / journal.numberOfFrames << endl;
+	}
+
+	return 0;
+}
+
+// folds the interesting bits of the state into a hash so gameplay changes show up in the output
+unsigned long long UpdateChecksum(unsigned long long checksum, const Game& game, const Player& player, const AlienSwarm& aliens) {
+	checksum = (checksum ^ unsigned(player.score)) * 1099511628211ULL;
+	checksum = (checksum ^ unsigned(player.position.x)) * 1099511628211ULL;
+	checksum = (checksum ^ unsigned(aliens.position.x + aliens.position.y * game.windowSize.width)) * 1099511628211ULL;
+	checksum = (checksum ^ unsigned(aliens.numAliensLeft + game.currentState * 256)) * 1099511628211ULL;
+	return checksum;
+}
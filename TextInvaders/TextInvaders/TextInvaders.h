@@ -4,6 +4,10 @@
 #include <vector>
 #include <ctime>
 #include <string>
+#include "GameTypes.h"
+#include "CursesUtils.h"
+#include "HighScoreFile.h"
+#include "InputJournal.h"
 
 const char* PLAYER_SPRITE[] = { " =A= ", "=====" };
 const char* PLAYER_EXPLOSION_SPRITE[] = { ",~^,'", "=====", "'+-`.", "=====" };
@@ -16,7 +20,10 @@ const char* ALIEN_EXPLOSION[] = { "\\||/", "/||\\" };
 const char* ALIEN_BOMB_SPRITE = "\\|/-";
 const char* ALIEN_UFO_SPRITE[] = { "_/oo\\_", "=q==p=" };
 
-const char* filename = "TextInvaderScoreTable.txt";
+const char* filename = "TextInvaderScoreTable.dat";
+const char* legacyFilename = "TextInvaderScoreTable.txt"; // read when there is no .dat yet
+const char* profileFilename = "TextInvadersProfile.csv"; // written on exit when run with --profile
+const char* journalFilename = "TextInvadersJournal.bin"; // written on exit when run with --record, read by --replay
 enum {
 	SHEILD_SPRITE_HEIGHT = 3,
 	SHEILD_SPRITE_WIDTH = 7,
@@ -35,13 +42,36 @@ enum {
 	ALIEN_SPRITE_HEIGHT = 2,
 	ALIEN_PADDING = 1,
 	ALIEN_EXPLOSION_TIME = 4,
+	ALIEN_ANIMATION_FRAMES = 2,
 	ALIEN_BOMB_SPEED = 1,
 	WAIT_TIME = 10,
 	NUM_LEVELS = 10,
 	UFO_SPRITE_WIDTH = 6,
 	UFO_SPRITE_HEIGHT = 2,
 	MAX_LENGHT_OF_NAME = 5,
-	MAX_HIGH_SCORES = 10
+	MAX_HIGH_SCORES = 10,
+	HEADLESS_WINDOW_WIDTH = 100,
+	HEADLESS_WINDOW_HEIGHT = 40,
+	HEADLESS_DEFAULT_FRAMES = 1000000,
+	HEADLESS_DEFAULT_SEED = 1,
+	STRESS_ALIEN_ROWS = 50,
+	STRESS_ALIEN_COLUMNS = 200,
+	STRESS_ALIEN_BOMBS = 500,
+	STRESS_DEFAULT_FRAMES = 10000,
+	MASK_BITS = 64, // bits in one word of an alien mask
+	SHIELD_ROW_STRIDE = SHEILD_SPRITE_WIDTH + 1, // a row keeps its '\0' so it can be drawn as a string
+	SHIELD_PIXELS = SHEILD_SPRITE_HEIGHT * SHIELD_ROW_STRIDE,
+	CACHE_LINE_SIZE = 64
+};
+
+const clock_t FIXED_TIMESTEP = CLOCKS_PER_SEC / FPS; // one UpdateGame, however long drawing takes
+
+enum AlienSprite {
+	ALIEN_SPRITE_30 = 0,
+	ALIEN_SPRITE_20,
+	ALIEN_SPRITE_10,
+	ALIEN_SPRITE_EXPLOSION,
+	NUM_ALIEN_SPRITES
 };
 
 enum AlienState {
@@ -50,25 +80,6 @@ enum AlienState {
 	AS_EXPLODING
 };
 
-enum GameState {
-	GS_INTRO = 0,
-	GS_HIGH_SCORES,
-	GS_PLAY,
-	GS_PLAYER_DEAD,
-	GS_WAIT,
-	GS_GAME_OVER
-};
-
-struct Position {
-	int x;
-	int y;
-};
-
-struct Size {
-	int width;
-	int height;
-};
-
 struct Player {
 	Position position;
 	Position missile;
@@ -81,7 +92,21 @@ struct Player {
 
 struct Shield {
 	Position position;
-	char* sprite[SHEILD_SPRITE_HEIGHT];
+	char* sprite[SHEILD_SPRITE_HEIGHT]; // rows inside the ShieldArena pixels
+};
+
+// Owns the pixels of every shield in one cache line aligned block, shield after shield,
+// plus an undamaged copy so a level reset is a single memcpy
+struct ShieldArena {
+	explicit ShieldArena(int numberOfShields);
+	~ShieldArena();
+	ShieldArena(const ShieldArena&) = delete;
+	ShieldArena& operator=(const ShieldArena&) = delete;
+
+	std::vector<Shield> shields;
+	char* pixels;
+	char* templatePixels;
+	char* allocation; // what new[] gave back, both blocks are aligned inside it
 };
 
 struct AlienBomb {
@@ -89,10 +114,37 @@ struct AlienBomb {
 	int animation;
 };
 
+// How big a wave is, NUM_ALIEN_ROWS x NUM_ALIEN_COLUMNS and so on unless a stress test asks for more
+struct WaveConfig {
+	int numAlienRows;
+	int numAlienColumns;
+	int maxNumberOfBombs;
+	int numShields;
+};
+
 struct AlienSwarm {
 	Position position;
-	AlienState aliens[NUM_ALIEN_ROWS][NUM_ALIEN_COLUMNS];
-	AlienBomb bombs[MAX_NUMBER_OF_ALIEN_BOMBS];
+	int numRows;
+	int numColumns;
+	int rowWords; // words in one row mask, enough for a bit per column
+	int columnWords; // words in one column mask, enough for a bit per row
+	// bit col of the row mask is set in aliveRows / explodingRows when that alien is alive / exploding,
+	// bit row of the column mask in aliveColumns mirrors aliveRows so a column can be read without walking the rows.
+	// Masks are rowWords (or columnWords) 64 bit words each, stored one after the other
+	std::vector<unsigned long long> aliveRows;
+	std::vector<unsigned long long> explodingRows;
+	std::vector<unsigned long long> aliveColumns;
+	std::vector<unsigned long long> columnsWithAliens; // one row mask, bit col set while that column has a live alien
+	// alive or exploding aliens in each column and row. An exploding alien keeps its place until the
+	// explosion is over, so these only go down in ClearExplodedAliens, which also moves the bounds in
+	std::vector<int> aliensInColumn;
+	std::vector<int> aliensInRow;
+	int firstColumn; // the swarm's bounds in the grid: columns and last row with an alien in them,
+	int lastColumn; // lastColumn and lastRow are NOT_IN_PLAY once every alien is gone
+	int lastRow;
+	int numAliensExploding;
+	std::vector<AlienBomb> bombs;
+	SpriteStrip rowSprites[NUM_ALIEN_SPRITES]; // every alien sprite across a whole row of the swarm, rebuilt with the swarm
 	Size spriteSize;
 	int animation;
 	int direction; // 1 for right, -1 for left;
@@ -109,22 +161,18 @@ struct AlienUFO {
 	int points;
 };
 
-struct Score {
-	int score;
-	std::string name;
-};
-
-struct HighScoreTable {
-	std::vector<Score> scores;
-};
-
 struct Game {
 	Size windowSize;
+	WaveConfig wave;
 	GameState currentState;
 	int level;
 	int waitTimer;
 	clock_t gameTimer;
 
+	// shield index covering each cell of the window (row by row), NOT_IN_PLAY where there is none.
+	// Shields never move, so this is only rebuilt when they are reset
+	std::vector<short> shieldOwners;
+
 	int gameOverHPositionCursor;
 	char playerName[MAX_LENGHT_OF_NAME + 1];
 	int gameOverVPositionCursor[MAX_LENGHT_OF_NAME];
@@ -1,27 +1,30 @@
 #include "TextSnake.h"
-#include "CursesUtils.h"
+#include "GameLoop.h"
+#include <cstring>
+#include <iostream>
+#include <chrono>
 
 using namespace std;
 
-void InitGame(Game& game);
+void InitGame(Game& game, const Size& windowSize);
 void InitPlayer(Game& game, Player& player);
 void InitAppleSpawner(AppleSpawner& appleSpawner);
-void LoadHighScore(HighScoreTable& table);
 
-int HandleInput(Game& game, Player& player, HighScoreTable& table, AppleSpawner& appleSpawner);
+int ProcessInput(int input, Game& game, Player& player, HighScoreTable& table, AppleSpawner& appleSpawner);
 void MovePlayer(const Game& game, Player& player);
 void ResetMovementTime(Player& player);
+int GetBodyIndex(const Player& player, int partNumber);
 void ChangePlayerDirection(Player& player, PlayerDirection direction);
 void UpdateGame(Game& game, Player& player, AppleSpawner& appleSpawner, clock_t dt);
 void UpdateApple(const Game& game, Player& player, AppleSpawner& appleSpawner);
 void UpdatePlayer(Game& game, Player& player, AppleSpawner& appleSpawner);
-void SaveHighScore(const HighScoreTable& table);
 
 bool IsCollision(Player& player, Apple& apple);
-bool IsSelfCollision(vector<SnakePart>& snakeBody);
+bool IsSelfCollision(const Player& player);
 bool PlayerOutOfBound(const Game& game, const SnakePart& snakeHead);
 void ResolveAppleCollision(Player& player, AppleSpawner& appleSpawner, Apple* apple);
 
+bool IsIdleScreen(const Game& game);
 void DrawGame(const Game& game, const Player& player, const AppleSpawner& appleSpawner, const HighScoreTable& table);
 void DrawPlayer(const Player& player);
 void DrawApples(const AppleSpawner& appleSpawner);
@@ -29,60 +32,101 @@ void ShowPlayerLive(const Game& game, const Player& player);
 void DrawIntroScreen(const Game& game);
 void DrawGameOverScreen(const Game& game);
 void DrawHighScoreTable(const Game& game, const HighScoreTable& table);
-void AddHighScore(HighScoreTable& table, int score, const std::string& name);
 
 void ResetGame(Game& game, Player& player, AppleSpawner& appleSpawner);
 void ResetPlayer(Game& game, Player& player);
 void ResetApples(AppleSpawner& appleSpawner);
 void ResetGameOverPositionCursor(Game& game);
 
-int main() {
-	srand(time(NULL));
+void ResetOccupancy(OccupancyGrid& grid, const Size& size);
+void OccupyCell(OccupancyGrid& grid, const Position& position);
+void FreeCell(OccupancyGrid& grid, const Position& position);
+int GetOccupancy(const OccupancyGrid& grid, const Position& position);
+bool IsSpawnableCell(const OccupancyGrid& grid, int cell);
+void UpdateFreeCell(OccupancyGrid& grid, int cell);
+void SetApple(OccupancyGrid& grid, const Position& position, bool hasApple);
+bool SpawnApple(Player& player, AppleSpawner& appleSpawner, Apple* apple);
+void SeedRandom(unsigned int seed);
+int GetRandom();
+int GetRandomIndex(int count);
+int RunStressTest(int width, int height, int freeCells, int samples);
+int RunReplay(const char* journalFile);
+
+int main(int argc, char* argv[]) {
+	unsigned int seed = unsigned(time(NULL));
+	SeedRandom(seed);
+
+	if (argc > 1 && strcmp(argv[1], "--stress") == 0) {
+		int width = (argc > 2) ? atoi(argv[2]) : STRESS_WINDOW_WIDTH;
+		int height = (argc > 3) ? atoi(argv[3]) : STRESS_WINDOW_HEIGHT;
+		int freeCells = (argc > 4) ? atoi(argv[4]) : STRESS_FREE_CELLS;
+		int samples = (argc > 5) ? atoi(argv[5]) : STRESS_SAMPLES;
+		return RunStressTest(width, height, freeCells, samples);
+	}
+	else if (argc > 1 && strcmp(argv[1], "--replay") == 0) {
+		return RunReplay((argc > 2) ? argv[2] : journalFilename);
+	}
+
+	// [--profile [file]] [--record [file]]
+	const char* profileFile = NULL;
+	const char* journalFile = NULL;
+	for (int i = 1; i < argc; i++) {
+		bool hasFileName = (i + 1 < argc) && argv[i + 1][0] != '-';
+		if (strcmp(argv[i], "--profile") == 0) {
+			profileFile = hasFileName ? argv[++i] : profileFilename;
+		}
+		else if (strcmp(argv[i], "--record") == 0) {
+			journalFile = hasFileName ? argv[++i] : journalFilename;
+		}
+	}
 
 	Game game;
 	Player player;
 	AppleSpawner appleSpawner;
 	HighScoreTable table;
+	InputJournal journal;
 
 	InitializeCurses(true);
-	InitGame(game);
+	InitGame(game, Size{ ScreenWidth(), ScreenHeight() });
+	InitInputJournal(journal, seed, game.windowSize);
 	InitPlayer(game, player);
 	InitAppleSpawner(appleSpawner);
-	LoadHighScore(table);
-
-	bool quit = false;
-	int input{ 0 };
-	clock_t lastTime = clock(); // from game loop
-
-	while (!quit) {
-		input = HandleInput(game, player, table, appleSpawner);
+	InitHighScoreTable(table, MAX_HIGH_SCORES, true, filename, legacyFilename);
+	LoadHighScores(table);
 
-		if (input != 'q') {
+	FrameProfiler profiler;
 
-			clock_t currentTime = clock();
-			clock_t dt = currentTime - lastTime;
-
-			if (dt > CLOCKS_PER_SEC / FPS) { // ( tick per sec / frame per sec ) --> tick per frame
-				lastTime = currentTime;
-
-				UpdateGame(game, player, appleSpawner, dt);
-				ClearScreen();
-				DrawGame(game, player, appleSpawner, table);
-				RefreshScreen();
+	RunGameLoop(FPS, profiler,
+		[&]() { return IsIdleScreen(game); },
+		[&]() {
+			int input = GetChar();
+			if (journalFile != NULL) {
+				RecordInput(journal, input);
 			}
-		}
-		else {
-			quit = true;
-		}
-	}
+			return ProcessInput(input, game, player, table, appleSpawner);
+		},
+		[&](clock_t dt) {
+			UpdateGame(game, player, appleSpawner, dt);
+			RecordFrame(journal);
+		},
+		[&]() { DrawGame(game, player, appleSpawner, table); });
 
 	ShutdownCurses();
-	return 0;
+
+	int result = 0;
+	if (profileFile != NULL && !WriteProfilerCsv(profiler, profileFile)) {
+		cerr << "Could not write " << profileFile << endl;
+		result = 1;
+	}
+	if (journalFile != NULL && !SaveInputJournal(journal, journalFile)) {
+		cerr << "Could not write " << journalFile << endl;
+		result = 1;
+	}
+	return result;
 }
 
-void InitGame(Game& game) {
-	game.windowSize.height = ScreenHeight();
-	game.windowSize.width = ScreenWidth();
+void InitGame(Game& game, const Size& windowSize) {
+	game.windowSize = windowSize;
 	game.currentState = GS_INTRO;
 	game.level = 1;
 	game.gameTimer = 0;
@@ -107,10 +151,18 @@ void InitPlayer(Game& game, Player& player) {
 }
 
 void ResetPlayer(Game& game, Player& player) {
-	player.body.clear();
+	// one slot per cell of the window is as long as the snake can ever get
+	int capacity = game.windowSize.width * game.windowSize.height + 1;
+	if (int(player.body.size()) != capacity) {
+		player.body.assign(capacity, SnakePart(NOT_IN_PLAY, NOT_IN_PLAY));
+	}
+	player.head = 0;
+
+	ResetOccupancy(player.occupancy, game.windowSize);
 	for (int i = 0; i < PLAYER_START_LENGTH; i++) {
 		SnakePart block(game.windowSize.width / 2 + i, game.windowSize.height / 2);
-		player.body.push_back(block);
+		player.body[i] = block;
+		OccupyCell(player.occupancy, block.position);
 	}
 
 	player.length = PLAYER_START_LENGTH;
@@ -133,11 +185,10 @@ void ResetApples(AppleSpawner& appleSpawner) {
 	appleSpawner.appleInPlay = 0;
 }
 
-int HandleInput(Game& game, Player& player, HighScoreTable& table, AppleSpawner& appleSpawner) {
-	int input = GetChar();
-
+int ProcessInput(int input, Game& game, Player& player, HighScoreTable& table, AppleSpawner& appleSpawner) {
 	switch (input) {
 	case 'q':
+	case PROFILER_TOGGLE_KEY:
 		return input;
 	case 's':
 		if (game.currentState == GS_INTRO) {
@@ -222,12 +273,9 @@ int HandleInput(Game& game, Player& player, HighScoreTable& table, AppleSpawner&
 }
 
 void MovePlayer(const Game& game, Player& player) {
-	Position HeadPos = player.body[0].position; // save old position
+	Position HeadPos = player.body[player.head].position; // save old position
 
-	// move body parts after the snake head
-	for (int i = player.length - 1; i > 0; i--) {
-		player.body[i].position = player.body[i - 1].position;
-	}
+	FreeCell(player.occupancy, player.body[GetBodyIndex(player, player.length - 1)].position); // the tail leaves its cell
 
 	switch (player.direction) {
 	case PS_UP:
@@ -246,7 +294,15 @@ void MovePlayer(const Game& game, Player& player) {
 		break;
 	}
 
-	player.body[0].position = HeadPos; // update next head position
+	// step the head back one slot, the old tail slot is now past the end of the snake
+	int capacity = int(player.body.size());
+	player.head = (player.head + capacity - 1) % capacity;
+	player.body[player.head].position = HeadPos; // update next head position
+	OccupyCell(player.occupancy, HeadPos);
+}
+
+int GetBodyIndex(const Player& player, int partNumber) {
+	return (player.head + partNumber) % int(player.body.size());
 }
 
 void ResetMovementTime(Player& player) {
@@ -286,7 +342,7 @@ void UpdateGame(Game& game, Player& player, AppleSpawner& appleSpawner, clock_t
 		UpdatePlayer(game, player, appleSpawner);
 
 		// player's snake eat itself or player's snake out of game window
-		if (IsSelfCollision(player.body) || PlayerOutOfBound(game, player.body[0])) {
+		if (IsSelfCollision(player) || PlayerOutOfBound(game, player.body[player.head])) {
 			game.currentState = GS_PLAYER_DEAD;
 		}
 	}
@@ -303,11 +359,9 @@ void UpdateGame(Game& game, Player& player, AppleSpawner& appleSpawner, clock_t
 }
 
 bool IsValidPosition(const AppleSpawner& applespawner, const Player& player, int xPos, int yPos) {
-	for (int i = 0; i < player.length; i++) {
-		SnakePart body = player.body[i];
-		if (xPos == body.position.x && yPos == body.position.y) {
-			return false;
-		}
+	Position position = { xPos, yPos };
+	if (GetOccupancy(player.occupancy, position) != 0) {
+		return false;
 	}
 
 	for (int i = 0; i < MAX_NUMBER_OF_APPLE; i++) {
@@ -332,22 +386,7 @@ void UpdateApple(const Game& game, Player& player, AppleSpawner& appleSpawner) {
 		for (int i = 0; i < MAX_NUMBER_OF_APPLE; i++) {
 			Apple* apple = &appleSpawner.apples[i];
 			if (apple->position.x == NOT_IN_PLAY || apple->position.y == NOT_IN_PLAY) {
-				int count = 0; // protected from forever loop
-				int xPos{ -1 }, yPos{ -1 };
-
-				// random position of the new apple
-				do {
-					count++;
-					xPos = rand() % (game.windowSize.width - 1);
-					yPos = rand() % (game.windowSize.height - 1);
-				} while (!IsValidPosition(appleSpawner, player, xPos, yPos) && count < 100);
-				
-				// spawn the new apple
-				if (count < 100) {
-					apple->position.x = xPos;
-					apple->position.y = yPos;
-
-					appleSpawner.appleInPlay++;
+				if (SpawnApple(player, appleSpawner, apple)) {
 					appleSpawner.spawnTimer = 0;
 				}
 				break;
@@ -356,8 +395,44 @@ void UpdateApple(const Game& game, Player& player, AppleSpawner& appleSpawner) {
 	}
 }
 
+bool SpawnApple(Player& player, AppleSpawner& appleSpawner, Apple* apple) {
+	OccupancyGrid& grid = player.occupancy;
+
+	if (grid.freeCells.empty()) {
+		return false; // the snake fills the board
+	}
+
+	// every free cell is equally likely, however full the board is
+	int cell = grid.freeCells[GetRandomIndex(int(grid.freeCells.size()))];
+
+	apple->position.x = cell % grid.size.width;
+	apple->position.y = cell / grid.size.width;
+	SetApple(grid, apple->position, true);
+
+	appleSpawner.appleInPlay++;
+	return true;
+}
+
+unsigned int randomState = 1;
+
+void SeedRandom(unsigned int seed) {
+	randomState = (seed == 0) ? 1 : seed; // xorshift gets stuck on a zero state
+}
+
+int GetRandom() {
+	// xorshift32 rather than rand(), so a replayed journal spawns the same apples on every platform
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 17;
+	randomState ^= randomState << 5;
+	return int(randomState & 0x7FFFFFFF);
+}
+
+int GetRandomIndex(int count) {
+	return int(unsigned(GetRandom()) % unsigned(count));
+}
+
 bool IsCollision(Player& player, Apple& apple) {
-	SnakePart head = player.body[0];
+	SnakePart head = player.body[player.head];
 	return (head.position.x == apple.position.x && head.position.y == apple.position.y);
 }
 
@@ -365,6 +440,7 @@ bool IsCollision(Player& player, Apple& apple) {
 void ResolveAppleCollision(Player& player, AppleSpawner& appleSpawner, Apple* apple) {
 	player.score += apple->point;
 
+	SetApple(player.occupancy, apple->position, false);
 	apple->position.x = NOT_IN_PLAY;
 	apple->position.y = NOT_IN_PLAY;
 	appleSpawner.appleInPlay--;
@@ -389,9 +465,14 @@ void DrawGame(const Game& game, const Player& player, const AppleSpawner& appleS
 	}
 }
 
+bool IsIdleScreen(const Game& game) {
+	// nothing moves on these screens until a key is pressed
+	return game.currentState == GS_INTRO || game.currentState == GS_HIGH_SCORES || game.currentState == GS_GAME_OVER;
+}
+
 void DrawPlayer(const Player& player) {
 	for (int i = 0; i < player.length; i++) {
-		SnakePart block = player.body[i];
+		SnakePart block = player.body[GetBodyIndex(player, i)];
 		DrawCharacter(block.position.x, block.position.y, SNAKE_SPRITE[player.animation]);
 	}
 }
@@ -425,9 +506,9 @@ void UpdatePlayer(Game& game, Player& player, AppleSpawner& appleSpawner) {
 		}
 	}
 
-	if (isAppleEaten) {
+	if (isAppleEaten && player.length < int(player.body.size())) {
 		// snake grow
-		Position tailEndPos = player.body[player.length - 1].position;
+		Position tailEndPos = player.body[GetBodyIndex(player, player.length - 1)].position;
 		switch (player.direction)
 		{
 		case PS_UP:
@@ -447,21 +528,84 @@ void UpdatePlayer(Game& game, Player& player, AppleSpawner& appleSpawner) {
 		}
 
 		SnakePart tailEnd(tailEndPos);
-		player.body.push_back(tailEnd);
+		player.body[GetBodyIndex(player, player.length)] = tailEnd;
+		OccupyCell(player.occupancy, tailEndPos);
 		player.length++;
 	}
 }
 
-bool IsSelfCollision(vector<SnakePart>& snakeBody) {
-	SnakePart head = snakeBody[0];
+bool IsSelfCollision(const Player& player) {
+	// the head counts once, anything more means another part is on the same cell
+	return GetOccupancy(player.occupancy, player.body[player.head].position) > 1;
+}
 
-	for (int i = 1; i < snakeBody.size(); i++) {
-		if (head.position.x == snakeBody[i].position.x &&
-			head.position.y == snakeBody[i].position.y) {
-			return true;
-		}
+// Also forgets every apple, callers reset the apple spawner together with the player
+void ResetOccupancy(OccupancyGrid& grid, const Size& size) {
+	int numberOfCells = size.width * size.height;
+
+	grid.size = size;
+	grid.cells.assign(numberOfCells, 0);
+	grid.apples.assign(numberOfCells, false);
+	grid.freeCells.clear();
+	grid.freeCells.reserve(numberOfCells);
+	grid.freeCellSlot.assign(numberOfCells, NOT_IN_PLAY);
+
+	for (int cell = 0; cell < numberOfCells; cell++) {
+		UpdateFreeCell(grid, cell);
+	}
+}
+
+void OccupyCell(OccupancyGrid& grid, const Position& position) {
+	// parts outside the window are not tracked, PlayerOutOfBound catches a head out there
+	if (position.x >= 0 && position.x < grid.size.width && position.y >= 0 && position.y < grid.size.height) {
+		int cell = position.y * grid.size.width + position.x;
+		grid.cells[cell]++;
+		UpdateFreeCell(grid, cell);
+	}
+}
+
+void FreeCell(OccupancyGrid& grid, const Position& position) {
+	if (position.x >= 0 && position.x < grid.size.width && position.y >= 0 && position.y < grid.size.height) {
+		int cell = position.y * grid.size.width + position.x;
+		grid.cells[cell]--;
+		UpdateFreeCell(grid, cell);
+	}
+}
+
+void SetApple(OccupancyGrid& grid, const Position& position, bool hasApple) {
+	int cell = position.y * grid.size.width + position.x;
+	grid.apples[cell] = hasApple;
+	UpdateFreeCell(grid, cell);
+}
+
+bool IsSpawnableCell(const OccupancyGrid& grid, int cell) {
+	// apples never spawned on the last row or column
+	return cell % grid.size.width < grid.size.width - 1 && cell / grid.size.width < grid.size.height - 1;
+}
+
+void UpdateFreeCell(OccupancyGrid& grid, int cell) {
+	bool isFree = grid.cells[cell] == 0 && !grid.apples[cell] && IsSpawnableCell(grid, cell);
+	int slot = grid.freeCellSlot[cell];
+
+	if (isFree && slot == NOT_IN_PLAY) {
+		grid.freeCellSlot[cell] = int(grid.freeCells.size());
+		grid.freeCells.push_back(cell);
 	}
-	return false;
+	else if (!isFree && slot != NOT_IN_PLAY) {
+		// swap the last free cell into this slot so removal is O(1)
+		int lastCell = grid.freeCells.back();
+		grid.freeCells[slot] = lastCell;
+		grid.freeCellSlot[lastCell] = slot;
+		grid.freeCells.pop_back();
+		grid.freeCellSlot[cell] = NOT_IN_PLAY;
+	}
+}
+
+int GetOccupancy(const OccupancyGrid& grid, const Position& position) {
+	if (position.x >= 0 && position.x < grid.size.width && position.y >= 0 && position.y < grid.size.height) {
+		return grid.cells[position.y * grid.size.width + position.x];
+	}
+	return 0;
 }
 
 bool PlayerOutOfBound(const Game& game, const SnakePart& snakeHead) {
@@ -514,13 +658,13 @@ void DrawGameOverScreen(const Game& game) {
 
 	for (int i = 0; i < MAX_LENGTH_OF_NAME; i++) {
 		if (i == game.gameOverHPositionCursor) {
-			attron(WA_UNDERLINE);
+			AttributeOn(WA_UNDERLINE);
 		}
 
 		DrawCharacter(game.windowSize.width / 2 - MAX_LENGTH_OF_NAME / 2 + i, yPos + 5, game.playerName[i]);
 
 		if (i == game.gameOverHPositionCursor) {
-			attroff(WA_UNDERLINE);
+			AttributeOff(WA_UNDERLINE);
 		}
 
 	}
@@ -534,86 +678,156 @@ void ResetGameOverPositionCursor(Game& game) {
 	}
 }
 
-bool ScoreCompare(const Score& score1, const Score& score2) {
-	return score1.score > score2.score;
-}
+void DrawHighScoreTable(const Game& game, const HighScoreTable& table) {
+	string title = "High Scores";
+	int titleXPos = game.windowSize.width / 2 - title.length() / 2;
+	int yPos = 5;
+	int yPadding = 2;
 
-void AddHighScore(HighScoreTable& table, int score, const std::string& name) {
-	Score highScore;
-	highScore.score = score;
-	highScore.name = name;
+	AttributeOn(A_UNDERLINE);
+	DrawString(titleXPos, yPos, title);
+	AttributeOff(A_UNDERLINE);
 
-	bool alreadyPlay = false;
-	for (auto& player : table.scores) {
-		if (player.name == name) {
-			if (score > player.score) {
-				player.score = score;
-			}
-			alreadyPlay = true;
-		}
-	}
+	for (int i = 0; i < int(table.scores.size()) && i < MAX_HIGH_SCORES; i++) {
+		Score score = table.scores[i];
 
-	if (!alreadyPlay) {
-		table.scores.push_back(highScore);
+		DrawFormattedString(titleXPos - MAX_LENGTH_OF_NAME/2, yPos + (i + 1) * yPadding, "%s        %i", score.name.c_str(), score.score);
 	}
-	
-	sort(table.scores.begin(), table.scores.end(), ScoreCompare);
-
-	SaveHighScore(table);
 }
 
-void SaveHighScore(const HighScoreTable& table) {
-	ofstream outFile;
-	outFile.open(filename);
+int RunStressTest(int width, int height, int freeCells, int samples) {
+	Game game;
+	Player player;
+	AppleSpawner appleSpawner;
 
-	if (outFile.is_open()) {
-		for (int i = 0; i < table.scores.size() && i < MAX_HIGH_SCORES; i++) {
-			outFile << table.scores[i].name << " " << table.scores[i].score << endl;
-		}
+	game.windowSize.width = width;
+	game.windowSize.height = height;
+	game.currentState = GS_PLAY;
+	InitPlayer(game, player);
+	InitAppleSpawner(appleSpawner);
+
+	// lay the snake back and forth across the spawnable area until only freeCells cells are left
+	int spawnableCells = (width - 1) * (height - 1);
+	int length = spawnableCells - freeCells;
+	if (length < PLAYER_START_LENGTH) {
+		cout << "The board is too small for that many free cells" << endl;
+		return 1;
 	}
-}
 
-void LoadHighScore(HighScoreTable& table) {
-	ifstream inFile;
+	ResetOccupancy(player.occupancy, game.windowSize);
+	player.head = 0;
+	player.length = length;
+	for (int i = 0; i < length; i++) {
+		int row = i / (width - 1);
+		int col = (row % 2 == 0) ? i % (width - 1) : width - 2 - i % (width - 1);
+		player.body[i] = SnakePart(col, row);
+		OccupyCell(player.occupancy, player.body[i].position);
+	}
 
-	inFile.open(filename);
+	vector<int> hits(width * height, 0);
+	int failures = 0;
 
-	string name;
-	int scoreVal;
+	chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
 
-	Score score;
+	for (int i = 0; i < samples; i++) {
+		Apple* apple = &appleSpawner.apples[0];
 
-	if (inFile.is_open()) {
-		while (!inFile.eof()) {
-			inFile >> ws;
-			if (inFile.eof()) {
-				break;
-			}
+		if (!SpawnApple(player, appleSpawner, apple)) {
+			failures++;
+			continue;
+		}
 
-			inFile >> name >> scoreVal;
-			score.name = name;
-			score.score = scoreVal;
+		Position position = apple->position;
+		SetApple(player.occupancy, position, false);
+		apple->position.x = NOT_IN_PLAY;
+		apple->position.y = NOT_IN_PLAY;
+		appleSpawner.appleInPlay--;
 
-			table.scores.push_back(score);
+		// the apple has to be on a cell that is neither snake nor another apple
+		if (!IsValidPosition(appleSpawner, player, position.x, position.y)) {
+			failures++;
 		}
+		hits[position.y * width + position.x]++;
+	}
 
-		inFile.close();
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - startTime;
+
+	int minHits = samples;
+	int maxHits = 0;
+	for (int cell = 0; cell < width * height; cell++) {
+		if (hits[cell] > 0) {
+			minHits = min(minHits, hits[cell]);
+			maxHits = max(maxHits, hits[cell]);
+		}
+	}
+
+	cout << "board:         " << width << "x" << height << ", snake length " << length << ", " << freeCells << " free cells" << endl;
+	cout << "samples:       " << samples << endl;
+	cout << "failures:      " << failures << endl;
+	cout << "hits per cell: " << minHits << " - " << maxHits << " (expected " << samples / max(freeCells, 1) << ")" << endl;
+	cout << "elapsed:       " << elapsed.count() << " s" << endl;
+	if (samples > 0) {
+		cout << "ns/spawn:      " << elapsed.count() * 1e9 / samples << endl;
 	}
+
+	return failures == 0 ? 0 : 1;
 }
 
-void DrawHighScoreTable(const Game& game, const HighScoreTable& table) {
-	string title = "High Scores";
-	int titleXPos = game.windowSize.width / 2 - title.length() / 2;
-	int yPos = 5;
-	int yPadding = 2;
+// Plays a journal written by --record back through the same updates, with no terminal and no waiting
+int RunReplay(const char* journalFile) {
+	InputJournal journal;
 
-	attron(A_UNDERLINE);
-	DrawString(titleXPos, yPos, title);
-	attroff(A_UNDERLINE);
+	if (!LoadInputJournal(journal, journalFile)) {
+		cout << "Could not read the journal " << journalFile << endl;
+		return 1;
+	}
 
-	for (int i = 0; i < table.scores.size() && i < MAX_HIGH_SCORES; i++) {
-		Score score = table.scores[i];
+	SeedRandom(journal.seed);
+
+	Game game;
+	Player player;
+	AppleSpawner appleSpawner;
+	HighScoreTable table;
+
+	InitGame(game, journal.windowSize);
+	InitPlayer(game, player);
+	InitAppleSpawner(appleSpawner);
+	InitHighScoreTable(table, MAX_HIGH_SCORES, true, NULL, NULL);
+
+	unsigned long long checksum = 14695981039346656037ULL;
+	int longestSnake = player.length;
+
+	chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
 
-		mvprintw(yPos + (i + 1) * yPadding, titleXPos - MAX_LENGTH_OF_NAME/2, "%s        %i", score.name.c_str(), score.score);
+	for (unsigned int frame = 0; frame < journal.numberOfFrames; frame++) {
+		for (int input = NextReplayInput(journal, frame); input != JOURNAL_NO_INPUT; input = NextReplayInput(journal, frame)) {
+			ProcessInput(input, game, player, table, appleSpawner);
+		}
+		UpdateGame(game, player, appleSpawner, FIXED_TIMESTEP);
+
+		// fold the interesting bits of the state into a hash so gameplay changes show up in the output
+		const Position& head = player.body[player.head].position;
+		checksum = (checksum ^ unsigned(player.score)) * 1099511628211ULL;
+		checksum = (checksum ^ unsigned(head.x + head.y * game.windowSize.width)) * 1099511628211ULL;
+		checksum = (checksum ^ unsigned(player.length + game.currentState * 65536)) * 1099511628211ULL;
+		longestSnake = max(longestSnake, player.length);
+	}
+
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - startTime;
+
+	cout << "journal:       " << journalFile << endl;
+	cout << "window:        " << journal.windowSize.width << " x " << journal.windowSize.height << endl;
+	cout << "seed:          " << journal.seed << endl;
+	cout << "frames:        " << journal.numberOfFrames << " (" << double(journal.numberOfFrames) / FPS << " s of play)" << endl;
+	cout << "keys:          " << journal.entries.size() << endl;
+	cout << "longest snake: " << longestSnake << endl;
+	cout << "best score:    " << (table.scores.empty() ? player.score : max(player.score, table.scores[0].score)) << endl;
+	cout << "checksum:      " << hex << checksum << dec << endl;
+	cout << "elapsed:       " << elapsed.count() << " s" << endl;
+	if (elapsed.count() > 0.0 && journal.numberOfFrames > 0) {
+		cout << "frames/sec:    " << journal.numberOfFrames / elapsed.count() << endl;
+		cout << "ns/frame:      " << elapsed.count() * 1e9 / journal.numberOfFrames << endl;
 	}
-}
\ No newline at end of file
+
+	return 0;
+}
@@ -7,11 +7,17 @@
 #include <cstdlib>
 #include <algorithm>
 #include <fstream>
+#include "GameTypes.h"
+#include "HighScoreFile.h"
+#include "InputJournal.h"
 
 const char APPLE_SPRITE = 'o';
 const char SNAKE_SPRITE[] = { '#', ' '};
 
-const char* filename = "TextSnakeScoreTable.txt";
+const char* filename = "TextSnakeScoreTable.dat";
+const char* legacyFilename = "TextSnakeScoreTable.txt"; // read when there is no .dat yet
+const char* profileFilename = "TextSnakeProfile.csv"; // written on exit when run with --profile
+const char* journalFilename = "TextSnakeJournal.bin"; // written on exit when run with --record, read by --replay
 enum {
 	MAX_NUMBER_OF_LIVE = 3,
 	MAX_NUMBER_OF_APPLE = 4,
@@ -24,17 +30,14 @@ enum {
 	PLAYER_WAIT_TIME = 48,
 	PLAYER_ANIMATION_LENGTH = 2,
 	MAX_LENGTH_OF_NAME = 4,
-	MAX_HIGH_SCORES = 15
+	MAX_HIGH_SCORES = 15,
+	STRESS_WINDOW_WIDTH = 80,
+	STRESS_WINDOW_HEIGHT = 24,
+	STRESS_FREE_CELLS = 8,
+	STRESS_SAMPLES = 1000000
 };
 
-enum GameState {
-	GS_INTRO = 0,
-	GS_HIGH_SCORES,
-	GS_PLAY,
-	GS_PLAYER_DEAD,
-	GS_WAIT,
-	GS_GAME_OVER
-};
+const clock_t FIXED_TIMESTEP = CLOCKS_PER_SEC / FPS; // one UpdateGame, however long drawing takes
 
 enum PlayerDirection {
 	PS_UP = 0,
@@ -42,16 +45,6 @@ enum PlayerDirection {
 	PS_DOWN,
 	PS_LEFT,
 };
-struct Position {
-	int x;
-	int y;
-};
-
-struct Size {
-	int width;
-	int height;
-};
-
 struct Apple {
 	Position position;
 	int point;
@@ -77,6 +70,16 @@ struct SnakePart {
 	}
 };
 
+// How many snake parts cover each cell of the window, so collision checks are a single lookup.
+// It also keeps the set of cells an apple may spawn on, so a free cell can be picked in O(1)
+struct OccupancyGrid {
+	Size size;
+	std::vector<unsigned short> cells;
+	std::vector<bool> apples;
+	std::vector<int> freeCells; // cell indexes in no particular order
+	std::vector<int> freeCellSlot; // where each cell is in freeCells, NOT_IN_PLAY when it is taken
+};
+
 struct Player {
 	int length;
 	int live;
@@ -85,19 +88,14 @@ struct Player {
 	PlayerDirection direction;
 	int movementTime;
 	int animation;
-	std::vector<SnakePart> body; // head is on index zero
+	// circular buffer sized to the whole window in ResetPlayer, so growing never reallocates.
+	// Part i of the snake (0 is the head) is body[(head + i) % body.size()]
+	std::vector<SnakePart> body;
+	int head;
+	OccupancyGrid occupancy; // kept in step with body by ResetPlayer, MovePlayer and UpdatePlayer
 	
 };
 
-struct Score {
-	int score;
-	std::string name;
-};
-
-struct HighScoreTable {
-	std::vector<Score> scores;
-};
-
 struct Game {
 	Size windowSize;
 	GameState currentState;
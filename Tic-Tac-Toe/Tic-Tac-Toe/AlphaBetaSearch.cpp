@@ -0,0 +1,393 @@
+#include "AlphaBetaSearch.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+using namespace std;
+
+struct ZobristKeys {
+	unsigned long long cells[2][MAX_BOARD_CELLS];
+	unsigned long long playerTwoToMove;
+};
+
+const int DIRECTIONS[4][2] = { { 0, 1 }, { 1, 0 }, { 1, 1 }, { 1, -1 } }; // row step, column step
+const int MATE_THRESHOLD = WIN_SCORE - MAX_BOARD_CELLS; // anything above is a forced win
+const long long NODES_BETWEEN_CLOCK_CHECKS = 4096;
+
+const ZobristKeys& GetZobristKeys();
+long long GetTimeMicroseconds();
+
+void UpdateNeighbours(GameBoard& board, int cell, int change);
+
+int Evaluate(const GameBoard& board, int player);
+int GenerateMoves(const AlphaBetaSearch& search, const GameBoard& board, int player, int ply, int tableMove, int moves[]);
+int Negamax(AlphaBetaSearch& search, GameBoard& board, int player, int depth, int ply, int alpha, int beta, int& bestMove);
+
+int ToTableValue(int value, int ply);
+int FromTableValue(int value, int ply);
+
+void InitGameBoard(GameBoard& board, int size, int winLength) {
+	board.size = size;
+	board.winLength = winLength;
+	board.cells.assign(size * size, ' ');
+	board.neighbours.assign(size * size, 0);
+	board.numberOfMarks = 0;
+	board.hash = 0;
+}
+
+void UpdateNeighbours(GameBoard& board, int cell, int change) {
+	int row = cell / board.size;
+	int column = cell % board.size;
+
+	for (int r = max(0, row - NEIGHBOUR_DISTANCE); r <= min(board.size - 1, row + NEIGHBOUR_DISTANCE); r++) {
+		for (int c = max(0, column - NEIGHBOUR_DISTANCE); c <= min(board.size - 1, column + NEIGHBOUR_DISTANCE); c++) {
+			board.neighbours[r * board.size + c] += change;
+		}
+	}
+}
+
+void PlaceMark(GameBoard& board, int cell, int player) {
+	board.cells[cell] = PLAYER_MARKS[player];
+	board.hash ^= GetZobristKeys().cells[player - 1][cell];
+	board.numberOfMarks++;
+	UpdateNeighbours(board, cell, 1);
+}
+
+void RemoveMark(GameBoard& board, int cell, int player) {
+	board.cells[cell] = ' ';
+	board.hash ^= GetZobristKeys().cells[player - 1][cell];
+	board.numberOfMarks--;
+	UpdateNeighbours(board, cell, -1);
+}
+
+// Only lines through the cell that was just played can have been completed
+bool IsWinningMove(const GameBoard& board, int cell) {
+	char mark = board.cells[cell];
+	int row = cell / board.size;
+	int column = cell % board.size;
+
+	for (int d = 0; d < 4; d++) {
+		int inARow = 1;
+
+		for (int side = -1; side <= 1; side += 2) {
+			int r = row + side * DIRECTIONS[d][0];
+			int c = column + side * DIRECTIONS[d][1];
+
+			while (r >= 0 && r < board.size && c >= 0 && c < board.size && board.cells[r * board.size + c] == mark) {
+				inARow++;
+				r += side * DIRECTIONS[d][0];
+				c += side * DIRECTIONS[d][1];
+			}
+		}
+
+		if (inARow >= board.winLength) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool IsBoardFull(const GameBoard& board) {
+	return board.numberOfMarks == board.size * board.size;
+}
+
+void InitSearch(AlphaBetaSearch& search, int tableSizeBits) {
+	search.table.assign(size_t(1) << tableSizeBits, TranspositionEntry());
+	search.tableMask = (1ULL << tableSizeBits) - 1;
+	search.history.assign(2 * MAX_BOARD_CELLS, 0);
+	search.nodes = 0;
+	search.tableHits = 0;
+	search.deadline = 0;
+	search.isStopped = false;
+}
+
+SearchResult FindBestMove(AlphaBetaSearch& search, GameBoard& board, int player, int maxDepth, long long timeLimit) {
+	long long startTime = GetTimeMicroseconds();
+	SearchResult result = { NO_CELL, 0, 0, 0, 0, 0.0 };
+
+	search.nodes = 0;
+	search.tableHits = 0;
+	search.deadline = (timeLimit > 0) ? startTime + timeLimit : 0;
+	search.isStopped = false;
+	for (int ply = 0; ply < MAX_SEARCH_DEPTH; ply++) {
+		search.killers[ply][0] = search.killers[ply][1] = NO_CELL;
+	}
+	// keep what the last search learned, but let this position's cutoffs take over quickly
+	for (size_t i = 0; i < search.history.size(); i++) {
+		search.history[i] /= 2;
+	}
+
+	int emptyCells = board.size * board.size - board.numberOfMarks;
+	maxDepth = min(maxDepth, min(emptyCells, int(MAX_SEARCH_DEPTH)));
+
+	for (int depth = 1; depth <= maxDepth; depth++) {
+		int bestMove = NO_CELL;
+		int value = Negamax(search, board, player, depth, 0, -WIN_SCORE, WIN_SCORE, bestMove);
+
+		if (search.isStopped) {
+			break; // a part searched depth can't be trusted, keep the previous one
+		}
+
+		result.bestMove = bestMove;
+		result.value = value;
+		result.depth = depth;
+
+		if (value > MATE_THRESHOLD || value < -MATE_THRESHOLD) {
+			break; // forced result, looking deeper won't change it
+		}
+	}
+
+	if (result.bestMove == NO_CELL) {
+		// out of time before depth 1 finished, any sensible move will do
+		int moves[MAX_BOARD_CELLS];
+		if (GenerateMoves(search, board, player, 0, NO_CELL, moves) > 0) {
+			result.bestMove = moves[0];
+		}
+	}
+
+	result.nodes = search.nodes;
+	result.tableHits = search.tableHits;
+	result.seconds = (GetTimeMicroseconds() - startTime) / 1e6;
+	return result;
+}
+
+int Negamax(AlphaBetaSearch& search, GameBoard& board, int player, int depth, int ply, int alpha, int beta, int& bestMove) {
+	search.nodes++;
+	if (search.deadline != 0 && search.nodes % NODES_BETWEEN_CLOCK_CHECKS == 0 && GetTimeMicroseconds() >= search.deadline) {
+		search.isStopped = true;
+	}
+	if (search.isStopped) {
+		return 0;
+	}
+
+	if (depth == 0) {
+		return Evaluate(board, player);
+	}
+
+	int originalAlpha = alpha;
+	unsigned long long key = board.hash ^ (player == 2 ? GetZobristKeys().playerTwoToMove : 0);
+	TranspositionEntry& entry = search.table[key & search.tableMask];
+	int tableMove = NO_CELL;
+
+	if (entry.key == key) {
+		search.tableHits++;
+		tableMove = entry.bestMove;
+
+		if (entry.depth >= depth && ply > 0) {
+			int value = FromTableValue(entry.value, ply);
+
+			if (entry.flag == TF_EXACT) {
+				return value;
+			}
+			else if (entry.flag == TF_LOWER_BOUND) {
+				alpha = max(alpha, value);
+			}
+			else {
+				beta = min(beta, value);
+			}
+
+			if (alpha >= beta) {
+				return value;
+			}
+		}
+	}
+
+	int moves[MAX_BOARD_CELLS];
+	int numberOfMoves = GenerateMoves(search, board, player, ply, tableMove, moves);
+	int bestValue = -WIN_SCORE;
+	bestMove = NO_CELL;
+
+	for (int i = 0; i < numberOfMoves; i++) {
+		int move = moves[i];
+		int value;
+
+		PlaceMark(board, move, player);
+		if (IsWinningMove(board, move)) {
+			value = WIN_SCORE - (ply + 1); // sooner wins score higher
+		}
+		else if (IsBoardFull(board)) {
+			value = 0;
+		}
+		else {
+			int reply;
+			value = -Negamax(search, board, 3 - player, depth - 1, ply + 1, -beta, -alpha, reply);
+		}
+		RemoveMark(board, move, player);
+
+		if (search.isStopped) {
+			return 0;
+		}
+
+		if (value > bestValue) {
+			bestValue = value;
+			bestMove = move;
+		}
+
+		if (value > alpha) {
+			alpha = value;
+		}
+
+		if (alpha >= beta) {
+			if (search.killers[ply][0] != move) {
+				search.killers[ply][1] = search.killers[ply][0];
+				search.killers[ply][0] = move;
+			}
+			search.history[(player - 1) * MAX_BOARD_CELLS + move] += depth * depth;
+			break;
+		}
+	}
+
+	entry.key = key;
+	entry.value = ToTableValue(bestValue, ply);
+	entry.bestMove = static_cast<short>(bestMove);
+	entry.depth = static_cast<signed char>(depth);
+	entry.flag = (bestValue <= originalAlpha) ? TF_UPPER_BOUND : (bestValue >= beta) ? TF_LOWER_BOUND : TF_EXACT;
+
+	return bestValue;
+}
+
+// Empty cells near the marks already played, best first: the table move, then
+// the killer moves for this ply, then by history score
+int GenerateMoves(const AlphaBetaSearch& search, const GameBoard& board, int player, int ply, int tableMove, int moves[]) {
+	int numberOfCells = board.size * board.size;
+
+	if (board.numberOfMarks == 0) {
+		moves[0] = (board.size / 2) * board.size + board.size / 2;
+		return 1;
+	}
+
+	int scores[MAX_BOARD_CELLS];
+	int numberOfMoves = 0;
+	const int* history = &search.history[(player - 1) * MAX_BOARD_CELLS];
+
+	// if everything near the marks is taken, fall back to every empty cell
+	for (int pass = 0; pass < 2 && numberOfMoves == 0; pass++) {
+		for (int cell = 0; cell < numberOfCells; cell++) {
+			if (board.cells[cell] != ' ' || (pass == 0 && board.neighbours[cell] == 0)) {
+				continue;
+			}
+
+			int score = history[cell];
+			if (cell == tableMove) {
+				score = 1 << 30;
+			}
+			else if (cell == search.killers[ply][0]) {
+				score = 1 << 29;
+			}
+			else if (cell == search.killers[ply][1]) {
+				score = 1 << 28;
+			}
+
+			// insertion sort, the lists are short and mostly arrive in order
+			int i = numberOfMoves++;
+			while (i > 0 && scores[i - 1] < score) {
+				moves[i] = moves[i - 1];
+				scores[i] = scores[i - 1];
+				i--;
+			}
+			moves[i] = cell;
+			scores[i] = score;
+		}
+	}
+
+	return numberOfMoves;
+}
+
+// Slides a winLength window along every line; a window holding only one player's
+// marks counts for that player, more the fewer marks it is missing
+int Evaluate(const GameBoard& board, int player) {
+	int weights[MAX_BOARD_SIZE + 1];
+	for (int count = 0; count <= board.winLength; count++) {
+		int missing = board.winLength - count;
+		weights[count] = (count == 0) ? 0 : 1 << max(0, 16 - 4 * (missing - 1));
+	}
+
+	int score[3] = { 0, 0, 0 };
+	char mine = PLAYER_MARKS[player];
+
+	for (int d = 0; d < 4; d++) {
+		int rowStep = DIRECTIONS[d][0];
+		int columnStep = DIRECTIONS[d][1];
+
+		for (int startCell = 0; startCell < board.size * board.size; startCell++) {
+			int row = startCell / board.size;
+			int column = startCell % board.size;
+			int previousRow = row - rowStep;
+			int previousColumn = column - columnStep;
+
+			// each line is walked once, from the cell that has no predecessor on the board
+			if (previousRow >= 0 && previousRow < board.size && previousColumn >= 0 && previousColumn < board.size) {
+				continue;
+			}
+
+			int count[2] = { 0, 0 }; // [mine, theirs] inside the window
+			for (int length = 0; row < board.size && column >= 0 && column < board.size; length++) {
+				char mark = board.cells[row * board.size + column];
+				if (mark != ' ') {
+					count[mark == mine ? 0 : 1]++;
+				}
+
+				if (length >= board.winLength) {
+					char leaving = board.cells[(row - board.winLength * rowStep) * board.size + column - board.winLength * columnStep];
+					if (leaving != ' ') {
+						count[leaving == mine ? 0 : 1]--;
+					}
+				}
+
+				if (length >= board.winLength - 1) {
+					if (count[1] == 0) {
+						score[0] += weights[count[0]];
+					}
+					else if (count[0] == 0) {
+						score[1] += weights[count[1]];
+					}
+				}
+
+				row += rowStep;
+				column += columnStep;
+			}
+		}
+	}
+
+	return score[0] - score[1];
+}
+
+int ToTableValue(int value, int ply) {
+	// wins are stored as distance from this node, not from the root
+	return (value > MATE_THRESHOLD) ? value + ply : (value < -MATE_THRESHOLD) ? value - ply : value;
+}
+
+int FromTableValue(int value, int ply) {
+	return (value > MATE_THRESHOLD) ? value - ply : (value < -MATE_THRESHOLD) ? value + ply : value;
+}
+
+const ZobristKeys& GetZobristKeys() {
+	static ZobristKeys keys = [] {
+		ZobristKeys newKeys;
+		unsigned long long state = 0x9E3779B97F4A7C15ULL;
+
+		// splitmix64, fixed seed so the hashes are the same every run
+		auto nextKey = [&state] {
+			unsigned long long z = (state += 0x9E3779B97F4A7C15ULL);
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+			return z ^ (z >> 31);
+		};
+
+		for (int player = 0; player < 2; player++) {
+			for (int cell = 0; cell < MAX_BOARD_CELLS; cell++) {
+				newKeys.cells[player][cell] = nextKey();
+			}
+		}
+		newKeys.playerTwoToMove = nextKey();
+		return newKeys;
+	}();
+
+	return keys;
+}
+
+long long GetTimeMicroseconds() {
+	return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
@@ -0,0 +1,78 @@
+#pragma once
+#ifndef __ALPHA_BETA_SEARCH_H__
+#define __ALPHA_BETA_SEARCH_H__
+
+#include <vector>
+
+// N x N board where K marks in a row (across, down or diagonal) wins, and the
+// computer player for it: iterative deepening alpha-beta with a Zobrist hashed
+// transposition table and TT move / killer / history move ordering.
+
+enum {
+	MIN_BOARD_SIZE = 3,
+	MAX_BOARD_SIZE = 15,
+	MAX_BOARD_CELLS = MAX_BOARD_SIZE * MAX_BOARD_SIZE,
+	MIN_WIN_LENGTH = 3,
+	NO_CELL = -1,
+	NEIGHBOUR_DISTANCE = 2, // only cells this close to a mark are searched
+	MAX_SEARCH_DEPTH = 64,
+	TRANSPOSITION_TABLE_BITS = 20,
+	WIN_SCORE = 1000000000
+};
+
+constexpr char PLAYER_MARKS[] = " OX"; // indexed by player, 0 = empty cell
+
+struct GameBoard {
+	int size;      // cells along each side
+	int winLength; // marks in a row needed to win
+	std::vector<char> cells; // ' ', 'O' (player 1) or 'X' (player 2), row by row
+	std::vector<unsigned char> neighbours; // marks within NEIGHBOUR_DISTANCE of each cell
+	int numberOfMarks;
+	unsigned long long hash; // Zobrist hash of the marks on the board
+};
+
+enum TranspositionFlag {
+	TF_EXACT = 0,
+	TF_LOWER_BOUND,
+	TF_UPPER_BOUND
+};
+
+struct TranspositionEntry {
+	unsigned long long key;
+	int value;
+	short bestMove;
+	signed char depth;
+	signed char flag;
+};
+
+struct AlphaBetaSearch {
+	std::vector<TranspositionEntry> table; // size is a power of two
+	unsigned long long tableMask;
+	std::vector<int> history; // [player - 1][cell], bumped on every beta cutoff
+	int killers[MAX_SEARCH_DEPTH][2];
+	long long nodes;
+	long long tableHits;
+	long long deadline; // steady clock microseconds, 0 = search until maxDepth
+	bool isStopped;
+};
+
+struct SearchResult {
+	int bestMove;
+	int value; // for the player to move
+	int depth; // last depth that was searched to the end
+	long long nodes;
+	long long tableHits;
+	double seconds;
+};
+
+void InitGameBoard(GameBoard& board, int size, int winLength);
+void PlaceMark(GameBoard& board, int cell, int player);
+void RemoveMark(GameBoard& board, int cell, int player);
+bool IsWinningMove(const GameBoard& board, int cell);
+bool IsBoardFull(const GameBoard& board);
+
+void InitSearch(AlphaBetaSearch& search, int tableSizeBits);
+// timeLimit is in microseconds, 0 for no limit
+SearchResult FindBestMove(AlphaBetaSearch& search, GameBoard& board, int player, int maxDepth, long long timeLimit);
+
+#endif
@@ -0,0 +1,55 @@
+#pragma once
+#ifndef __BOARD_EVALUATOR_H__
+#define __BOARD_EVALUATOR_H__
+
+// Each player's marks are a 9 bit mask, bit i set when that player owns cell i (0 - 8, row by row).
+
+enum BoardEvaluation {
+	BE_IN_PLAY = 0,
+	BE_PLAYER_ONE_WIN,
+	BE_PLAYER_TWO_WIN,
+	BE_TIE
+};
+
+enum {
+	FULL_BOARD_MASK = 0x1FF,
+	NUM_WIN_MASKS = 8
+};
+
+constexpr int WIN_MASKS[NUM_WIN_MASKS] = {
+	0x007, 0x038, 0x1C0, // rows
+	0x049, 0x092, 0x124, // columns
+	0x111, 0x054         // diagonals
+};
+
+struct WinTable {
+	bool isWin[FULL_BOARD_MASK + 1];
+};
+
+constexpr WinTable BuildWinTable() {
+	WinTable table = {};
+	for (int mask = 0; mask <= FULL_BOARD_MASK; mask++) {
+		for (int i = 0; i < NUM_WIN_MASKS; i++) {
+			if ((mask & WIN_MASKS[i]) == WIN_MASKS[i]) {
+				table.isWin[mask] = true;
+			}
+		}
+	}
+	return table;
+}
+
+// every one of the 512 masks answered up front, so a check is one load
+constexpr WinTable WIN_TABLE = BuildWinTable();
+
+constexpr bool HasWinningLine(int marksMask) {
+	return WIN_TABLE.isWin[marksMask & FULL_BOARD_MASK];
+}
+
+constexpr BoardEvaluation EvaluateBoard(int playerOneMask, int playerTwoMask) {
+	return HasWinningLine(playerOneMask) ? BE_PLAYER_ONE_WIN
+		: HasWinningLine(playerTwoMask) ? BE_PLAYER_TWO_WIN
+		: ((playerOneMask | playerTwoMask) == FULL_BOARD_MASK) ? BE_TIE
+		: BE_IN_PLAY;
+}
+
+#endif
@@ -0,0 +1,88 @@
+#pragma once
+#ifndef __PERFECT_PLAY_H__
+#define __PERFECT_PLAY_H__
+
+#include "BoardEvaluator.h"
+
+// Minimax value and best move for every 3x3 board, worked out by the compiler.
+// A board is a base 3 number: cell i is digit i with 0 = blank, 1 = 'O' (player 1), 2 = 'X' (player 2).
+
+enum {
+	NUM_CELLS = 9,
+	NUM_BOARD_STATES = 19683, // 3^9
+	NO_MOVE = -1
+};
+
+struct PerfectPlayEntry {
+	signed char value; // for the player to move: 1 win, 0 draw, -1 loss
+	signed char bestMove; // cell index, NO_MOVE when the game is already over
+};
+
+struct PerfectPlayTable {
+	PerfectPlayEntry entries[2][NUM_BOARD_STATES]; // [player to move - 1][board]
+};
+
+constexpr int POWERS_OF_THREE[NUM_CELLS] = { 1, 3, 9, 27, 81, 243, 729, 2187, 6561 };
+
+constexpr PerfectPlayTable BuildPerfectPlayTable() {
+	PerfectPlayTable table = {};
+
+	// Placing a mark always makes the board number bigger, so walking down from the
+	// biggest board means every reply has been solved before the board that leads to it
+	for (int state = NUM_BOARD_STATES - 1; state >= 0; state--) {
+		int marks[2] = { 0, 0 };
+
+		for (int i = 0, rest = state; i < NUM_CELLS; i++, rest /= 3) {
+			if (rest % 3 != 0) {
+				marks[rest % 3 - 1] |= 1 << i;
+			}
+		}
+
+		for (int player = 1; player <= 2; player++) {
+			int opponent = 3 - player;
+			PerfectPlayEntry entry = { 0, NO_MOVE };
+
+			if (HasWinningLine(marks[player - 1])) {
+				entry.value = 1;
+			}
+			else if (HasWinningLine(marks[opponent - 1])) {
+				entry.value = -1;
+			}
+			else if ((marks[0] | marks[1]) != FULL_BOARD_MASK) {
+				entry.value = -2;
+
+				for (int i = 0; i < NUM_CELLS; i++) {
+					if (((marks[0] | marks[1]) & (1 << i)) == 0) {
+						int value = -table.entries[opponent - 1][state + player * POWERS_OF_THREE[i]].value;
+
+						if (value > entry.value) {
+							entry.value = static_cast<signed char>(value);
+							entry.bestMove = static_cast<signed char>(i);
+						}
+					}
+				}
+			}
+
+			table.entries[player - 1][state] = entry;
+		}
+	}
+
+	return table;
+}
+
+constexpr PerfectPlayTable PERFECT_PLAY_TABLE = BuildPerfectPlayTable();
+
+inline int GetBoardState(const char* board) {
+	int state = 0;
+	for (int i = 0; i < NUM_CELLS; i++) {
+		state += (board[i] == 'O' ? 1 : board[i] == 'X' ? 2 : 0) * POWERS_OF_THREE[i];
+	}
+	return state;
+}
+
+// Best cell (0 - 8) for the player on this board, a single table lookup
+inline int GetPerfectMove(const char* board, int playerTurn) {
+	return PERFECT_PLAY_TABLE.entries[playerTurn - 1][GetBoardState(board)].bestMove;
+}
+
+#endif
@@ -1,8 +1,16 @@
 #include <iostream>
 #include <cstring>
 #include <cctype>
+#include <cstdlib>
+#include <chrono>
+#include <iomanip>
+#include <string>
+#include <algorithm>
 
 #include "Utils.h"
+#include "AlphaBetaSearch.h"
+#include "BoardEvaluator.h"
+#include "PerfectPlay.h"
 
 using namespace std;
 
@@ -12,24 +20,47 @@ enum GameResult {
 	PlayerTwoWin // Cross win
 };
 
+struct GameSettings {
+	int boardSize;
+	int winLength;
+	bool isPlayerTwoComputer;
+};
+
 const int IGNORE_CHARS = 256;
 const char* INPUT_ERROR_STRING = "Input error! Please try again.";
+const long long COMPUTER_THINKING_TIME = 1000000; // microseconds per move on the bigger boards
 
-void PlayGame(int starter);
+void PlayGame(const GameSettings& settings, int starter);
 bool WantToPlayAgain(int& lastStarter);
+bool WantToPlayComputer();
+void GetBoardSettings(GameSettings& settings);
+bool IsClassicBoard(const GameBoard& board);
+
+int GetPlayerInput(const GameBoard& board, int playerTurn);
+int GetComputerInput(GameBoard& board, int playerTurn, AlphaBetaSearch& search);
+int RunBenchmark(long long numberOfLookups);
+int RunSearchBenchmark(int boardSize, int winLength, int depth);
 
-int GetPlayerInput(int playerTurn, DynamicArray* validPos);
+void DrawBoard(const GameBoard& board);
+void UpdateBoard(GameBoard& board, int marks[2], int playerTurn, int placePosition);
 
-void DrawBoard(char* Board);
-void UpdateBoard(char* Board, int playerTurn, int placePosition);
+bool IsGameOver(const GameBoard& board, const int marks[2], int lastPosition, int& playerTurn, GameResult& result);
 
-bool IsGameOver(char* Board, int& playerTurn, GameResult& result);
+int main(int argc, char* argv[]) {
+	if (argc > 1 && strcmp(argv[1], "--bench") == 0) {
+		return RunBenchmark((argc > 2) ? atoll(argv[2]) : 10000000);
+	}
+	else if (argc > 1 && strcmp(argv[1], "--search-bench") == 0) {
+		return RunSearchBenchmark((argc > 2) ? atoi(argv[2]) : MAX_BOARD_SIZE, (argc > 3) ? atoi(argv[3]) : 5, (argc > 4) ? atoi(argv[4]) : 4);
+	}
 
-int main() {
 	int starter = 1;
+	GameSettings settings;
+	settings.isPlayerTwoComputer = WantToPlayComputer();
+	GetBoardSettings(settings);
 	do
 	{
-		PlayGame(starter);
+		PlayGame(settings, starter);
 
 	} while (WantToPlayAgain(starter));
 
@@ -37,28 +68,31 @@ int main() {
 	return 0;
 }
 
-void PlayGame(int stater) {
-	const int BOARD_SIZE = 9;
+void PlayGame(const GameSettings& settings, int stater) {
 	GameResult result;
 	int playerTurn = stater;
 
-	char* Board = new char[BOARD_SIZE]; // Create new empty board
-	for (int i = 0; i < BOARD_SIZE; ++i) {
-		Board[i] = ' ';
-	}
-	DrawBoard(Board); // Display empty board
+	GameBoard board; // Create new empty board
+	InitGameBoard(board, settings.boardSize, settings.winLength);
+	int marks[2] = { 0, 0 }; // bit masks of the cells each player owns, used on the 3x3 board
+	DrawBoard(board); // Display empty board
 
-	DynamicArray* validPos = CreateDynamicArray(BOARD_SIZE);
-	for (int i = 0; i < validPos->capacity; ++i) {
-		InsertElement(validPos, i + 1 + '0');
+	AlphaBetaSearch search;
+	if (settings.isPlayerTwoComputer && !IsClassicBoard(board)) {
+		InitSearch(search, TRANSPOSITION_TABLE_BITS);
 	}
 
 	int position;
 	do {
-		position = GetPlayerInput(playerTurn, validPos);
-		UpdateBoard(Board, playerTurn, position); 
-		DrawBoard(Board);
-	} while (!IsGameOver(Board, playerTurn, result));
+		if (playerTurn == 2 && settings.isPlayerTwoComputer) {
+			position = GetComputerInput(board, playerTurn, search);
+		}
+		else {
+			position = GetPlayerInput(board, playerTurn);
+		}
+		UpdateBoard(board, marks, playerTurn, position); 
+		DrawBoard(board);
+	} while (!IsGameOver(board, marks, position, playerTurn, result));
 
 	// Show result
 	switch (result)
@@ -75,88 +109,92 @@ void PlayGame(int stater) {
 		cout << "Player2 wins!" << endl;
 		break;
 	}
-	delete[] Board;
-	DeleteDynamicArray(validPos);
 }
 
-int GetPlayerInput(int playerTurn, DynamicArray* validPos) {
+bool IsClassicBoard(const GameBoard& board) {
+	return board.size == 3 && board.winLength == 3;
+}
+
+int GetPlayerInput(const GameBoard& board, int playerTurn) {
 	cout << "-------Player" << playerTurn << "'s turn-------\n";
-	char input = GetCharacter("Pls, select your position (1-9): ", INPUT_ERROR_STRING, validPos->dynamicArray, validPos->size);
-	int position = (input - '0') - 1;
-	DeleteElementByValue(validPos, input);
+
+	if (IsClassicBoard(board)) {
+		DynamicArray* validPos = CreateDynamicArray(NUM_CELLS);
+		for (int i = 0; i < NUM_CELLS; ++i) {
+			if (board.cells[i] == ' ') {
+				InsertElement(validPos, i + 1 + '0');
+			}
+		}
+
+		char input = GetCharacter("Pls, select your position (1-9): ", INPUT_ERROR_STRING, validPos->dynamicArray, validPos->size);
+		DeleteDynamicArray(validPos);
+		return (input - '0') - 1;
+	}
+
+	int position;
+	do {
+		int row = GetInteger("Row: ", INPUT_ERROR_STRING, 1, board.size);
+		int column = GetInteger("Column: ", INPUT_ERROR_STRING, 1, board.size);
+		position = (row - 1) * board.size + (column - 1);
+
+		if (board.cells[position] != ' ') {
+			cout << "That cell is taken." << endl;
+		}
+	} while (board.cells[position] != ' ');
+
 	return position;
 }
 
-void UpdateBoard(char* Board, int playerTurn, int placePosition) {
-	if (playerTurn == 1) {
-		Board[placePosition] = 'O';
+int GetComputerInput(GameBoard& board, int playerTurn, AlphaBetaSearch& search) {
+	if (IsClassicBoard(board)) {
+		return GetPerfectMove(board.cells.data(), playerTurn);
 	}
-	else if (playerTurn == 2) {
-		Board[placePosition] = 'X';
+
+	cout << "Computer is thinking..." << endl;
+	return FindBestMove(search, board, playerTurn, MAX_SEARCH_DEPTH, COMPUTER_THINKING_TIME).bestMove;
+}
+
+void UpdateBoard(GameBoard& board, int marks[2], int playerTurn, int placePosition) {
+	if (IsClassicBoard(board)) {
+		marks[playerTurn - 1] |= 1 << placePosition;
 	}
+
+	PlaceMark(board, placePosition, playerTurn);
 }
 
-bool IsGameOver(char* Board, int& playerTurn, GameResult& result) {
-	int lastPlayerturn = playerTurn;
+bool IsGameOver(const GameBoard& board, const int marks[2], int lastPosition, int& playerTurn, GameResult& result) {
+	int lastPlayer = playerTurn;
 	playerTurn = 1 + playerTurn % 2; // Change player turn
 
-	char checking;
-	if (lastPlayerturn == 1) {
-		checking = 'O';
-	}
-	else {
-		checking = 'X';
-	}
-	// Horizontal
-	for (int i = 0; i < 9; i = i + 3) {
-		bool found = true;
-		for (int j = i; j < i + 3; ++j) {
-			if (Board[j] != checking) {
-				found = false;
-				break;
-			}
-		}
-		if (found) {
-			result = (lastPlayerturn == 1) ? PlayerOneWin : PlayerTwoWin;
+	if (!IsClassicBoard(board)) {
+		// only the mark just placed can have finished a line
+		if (IsWinningMove(board, lastPosition)) {
+			result = (lastPlayer == 1) ? PlayerOneWin : PlayerTwoWin;
 			return true;
 		}
-	}
-	// Vertical
-	for (int i = 0; i < 3; ++i) {
-		bool found = true;
-		for (int j = i; j < 9; j = j + 3) {
-			if (Board[j] != checking) {
-				found = false;
-				break;
-			}
-		}
-		if (found) {
-			result = (lastPlayerturn == 1) ? PlayerOneWin : PlayerTwoWin;
+		else if (IsBoardFull(board)) {
+			result = Tie;
 			return true;
 		}
+		return false;
 	}
 
-	// Right diagonal
-	if (Board[0] == checking && Board[4] == checking && Board[8] == checking) {
-		result = (lastPlayerturn == 1) ? PlayerOneWin : PlayerTwoWin;
+	switch (EvaluateBoard(marks[0], marks[1])) {
+	case BE_PLAYER_ONE_WIN:
+		result = PlayerOneWin;
 		return true;
-	}
 
-	// Left diagonal
-	if (Board[2] == checking && Board[4] == checking && Board[6] == checking) {
-		result = (lastPlayerturn == 1) ? PlayerOneWin : PlayerTwoWin;
+	case BE_PLAYER_TWO_WIN:
+		result = PlayerTwoWin;
 		return true;
-	}
 
-	// If There are some blank spaces, game is not finish yet.
-	for (int i = 0; i < 9; ++i) {
-		if (Board[i] == ' ') {
-			return false;
-		}
-	}
+	case BE_TIE:
+		result = Tie;
+		return true;
 
-	result = Tie;
-	return true;
+	default:
+		return false;
+	}
 }
 
 bool WantToPlayAgain(int& lastStarter) {
@@ -167,14 +205,170 @@ bool WantToPlayAgain(int& lastStarter) {
 	return response == 'y';
 }
 
-void DrawBoard(char* Board) {
+bool WantToPlayComputer() {
+	const char validInputs[] = { '1', '2' };
+
+	char response = GetCharacter("Who would you like to play against?\n1. Human\n2. Computer\n\nWhat is your choice? ", INPUT_ERROR_STRING, validInputs, 2);
+	return response == '2';
+}
+
+void GetBoardSettings(GameSettings& settings) {
+	settings.boardSize = GetInteger("Board size (3-15): ", INPUT_ERROR_STRING, MIN_BOARD_SIZE, MAX_BOARD_SIZE);
+	settings.winLength = MIN_WIN_LENGTH;
+
+	if (settings.boardSize > MIN_BOARD_SIZE) {
+		cout << "Marks in a row to win (" << MIN_WIN_LENGTH << "-" << settings.boardSize << "): ";
+		settings.winLength = GetInteger("", INPUT_ERROR_STRING, MIN_WIN_LENGTH, settings.boardSize);
+	}
+}
+
+void DrawBoard(const GameBoard& board) {
 	ClearScreen();
 
-	cout << "+-+-+-+" << endl;
-	cout << "|"<< Board[0] << "|" << Board[1] << "|" << Board[2] << "|" << endl;
-	cout << "+-+-+-+" << endl;
-	cout << "|" << Board[3] << "|" << Board[4] << "|" << Board[5] << "|" << endl;
-	cout << "+-+-+-+" << endl;
-	cout << "|" << Board[6] << "|" << Board[7] << "|" << Board[8] << "|" << endl;
-	cout << "+-+-+-+" << endl;
+	if (board.size > MIN_BOARD_SIZE) {
+		// numbered rows and columns, so the player can tell the computer where to go
+		cout << "   ";
+		for (int column = 0; column < board.size; column++) {
+			cout << setw(2) << column + 1;
+		}
+		cout << endl;
+	}
+
+	string separator = "+";
+	for (int column = 0; column < board.size; column++) {
+		separator += "-+";
+	}
+
+	for (int row = 0; row < board.size; row++) {
+		cout << ((board.size > MIN_BOARD_SIZE) ? "   " : "") << separator << endl;
+
+		if (board.size > MIN_BOARD_SIZE) {
+			cout << setw(2) << row + 1 << " ";
+		}
+		cout << "|";
+		for (int column = 0; column < board.size; column++) {
+			cout << board.cells[row * board.size + column] << "|";
+		}
+		cout << endl;
+	}
+	cout << ((board.size > MIN_BOARD_SIZE) ? "   " : "") << separator << endl;
+}
+
+
+int RunBenchmark(long long numberOfLookups) {
+	// Collect every board that can come up in a game, grouped by how many marks are on it
+	const int MAX_BOARDS_PER_LEVEL = 2048;
+	static int boards[NUM_CELLS][MAX_BOARDS_PER_LEVEL];
+	int numberOfBoards[NUM_CELLS] = {};
+
+	for (int state = 0; state < NUM_BOARD_STATES; state++) {
+		int marks[3] = {};
+		for (int i = 0, rest = state; i < NUM_CELLS; i++, rest /= 3) {
+			marks[rest % 3]++;
+		}
+
+		int level = marks[1] + marks[2];
+		bool isPlayable = marks[1] - marks[2] >= -1 && marks[1] - marks[2] <= 1 && level < NUM_CELLS
+			&& PERFECT_PLAY_TABLE.entries[0][state].bestMove != NO_MOVE;
+
+		if (isPlayable && numberOfBoards[level] < MAX_BOARDS_PER_LEVEL) {
+			boards[level][numberOfBoards[level]++] = state;
+		}
+	}
+
+	cout << "marks  boards  ns/move" << endl;
+
+	long long checksum = 0;
+	for (int level = 0; level < NUM_CELLS; level++) {
+		char Board[NUM_CELLS];
+		chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+		for (long long n = 0; n < numberOfLookups; n++) {
+			int state = boards[level][n % numberOfBoards[level]];
+			for (int i = 0, rest = state; i < NUM_CELLS; i++, rest /= 3) {
+				Board[i] = " OX"[rest % 3];
+			}
+			checksum += GetPerfectMove(Board, 1 + int(n & 1));
+		}
+
+		chrono::duration<double> elapsed = chrono::steady_clock::now() - startTime;
+		cout << "  " << level << "    " << numberOfBoards[level] << "    " << elapsed.count() * 1e9 / numberOfLookups << endl;
+	}
+
+	// the evaluator on its own, over every pair of non overlapping masks
+	chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+	long long numberOfEvaluations = 0;
+
+	for (int pass = 0; pass < 16; pass++) {
+		for (int playerOneMask = 0; playerOneMask <= FULL_BOARD_MASK; playerOneMask++) {
+			for (int playerTwoMask = 0; playerTwoMask <= FULL_BOARD_MASK; playerTwoMask++) {
+				if ((playerOneMask & playerTwoMask) == 0) {
+					checksum += EvaluateBoard(playerOneMask, playerTwoMask);
+					numberOfEvaluations++;
+				}
+			}
+		}
+	}
+
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - startTime;
+	cout << "evaluations/sec: " << numberOfEvaluations / elapsed.count() << endl;
+
+	cout << "checksum: " << checksum << endl;
+	return 0;
+}
+
+// Searches a handful of fixed openings to a fixed depth, so runs are comparable
+int RunSearchBenchmark(int boardSize, int winLength, int depth) {
+	const int NUM_POSITIONS = 8;
+	const int OPENING_MARKS = 6;
+
+	boardSize = max(int(MIN_BOARD_SIZE), min(boardSize, int(MAX_BOARD_SIZE)));
+	winLength = max(int(MIN_WIN_LENGTH), min(winLength, boardSize));
+
+	AlphaBetaSearch search;
+	InitSearch(search, TRANSPOSITION_TABLE_BITS);
+
+	long long totalNodes = 0;
+	double totalSeconds = 0.0;
+	unsigned int seed = 12345;
+
+	cout << "board " << boardSize << "x" << boardSize << ", " << winLength << " in a row, depth " << depth << endl;
+	cout << "position  move  value  nodes  table hits  nodes/sec" << endl;
+
+	for (int n = 0; n < NUM_POSITIONS; n++) {
+		GameBoard board;
+		InitGameBoard(board, boardSize, winLength);
+
+		// scatter a few marks around the centre with a fixed seed
+		int player = 1;
+		int centre = boardSize / 2;
+		for (int placed = 0; placed < OPENING_MARKS && placed < boardSize * boardSize / 2; ) {
+			seed = seed * 1103515245 + 12345;
+			int row = max(0, min(boardSize - 1, centre - 2 + int((seed >> 16) % 5)));
+			seed = seed * 1103515245 + 12345;
+			int column = max(0, min(boardSize - 1, centre - 2 + int((seed >> 16) % 5)));
+			int cell = row * boardSize + column;
+
+			if (board.cells[cell] == ' ') {
+				PlaceMark(board, cell, player);
+				if (IsWinningMove(board, cell)) {
+					RemoveMark(board, cell, player);
+					continue;
+				}
+				player = 3 - player;
+				placed++;
+			}
+		}
+
+		SearchResult result = FindBestMove(search, board, player, depth, 0);
+		totalNodes += result.nodes;
+		totalSeconds += result.seconds;
+
+		cout << "  " << n << "       " << result.bestMove << "  " << result.value << "  " << result.nodes << "  "
+			<< result.tableHits << "  " << result.nodes / max(result.seconds, 1e-9) << endl;
+	}
+
+	cout << "total nodes: " << totalNodes << endl;
+	cout << "nodes/sec: " << totalNodes / max(totalSeconds, 1e-9) << endl;
+	return 0;
 }
@@ -9,6 +9,8 @@
 #include "Utils.h"
 #include <iostream>
 #include <cctype>
+#include <cstdlib>
+#include <limits>
 
 using namespace std;
 
@@ -104,18 +106,61 @@ char GetCharacter(const char* prompt, const char* error, const char validInput[]
 	return input;
 }
 
-void ClearScreen()
+int GetInteger(const char* prompt, const char* error, int minValue, int maxValue)
 {
-	system("cls"); //for windows only!
-	//system("clear");
+
+	const int IGNORE_CHARS = 256;
+
+	int input;
+	bool failure;
+
+	do
+	{
+		failure = false;
+
+		cout << prompt;
+		cin >> input;
+
+		if (cin.fail())
+		{
+			cin.clear();
+			cin.ignore(IGNORE_CHARS, '\n');
+			cout << error << endl;
+			failure = true;
+		}
+		else
+		{
+			cin.ignore(IGNORE_CHARS, '\n');
+
+			if (input < minValue || input > maxValue)
+			{
+				cout << error << endl;
+				failure = true;
+			}
+		}
+
+	} while (failure);
+
+	return input;
 }
 
+void ClearScreen()
+{
+#ifdef _WIN32
+	system("cls");
+#else
+	cout << "\033[2J\033[H" << flush; // ANSI clear screen and cursor home
+#endif
+}
 
 void WaitForKeyPress()
 {
-	system("pause"); //Windows only!
-
-	//system("read -n 1 -s -p \"Press any key to continue...\";echo");
+#ifdef _WIN32
+	system("pause");
+#else
+	cout << "Press Enter to continue..." << flush;
+	cin.ignore(numeric_limits<streamsize>::max(), '\n');
+#endif
 }
 
 
@@ -15,6 +15,7 @@ struct DynamicArray {
 
 char GetCharacter(const char* prompt, const char* error, CharacterCaseType charCase);
 char GetCharacter(const char* prompt, const char* error, const char validInput[], int validInputLength);
+int GetInteger(const char* prompt, const char* error, int minValue, int maxValue);
 
 void ClearScreen();
 